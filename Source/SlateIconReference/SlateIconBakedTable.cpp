@@ -0,0 +1,110 @@
+﻿// Copyright 2025, Aquanox.
+
+#include "SlateIconBakedTable.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace SlateIconBakedTable
+{
+	constexpr uint32 FileMagic = 0x53494254; // SIBT
+	constexpr uint32 FileVersion = 1;
+}
+
+FSlateIconBakedTable& FSlateIconBakedTable::Get()
+{
+	static FSlateIconBakedTable Instance;
+	static bool bLoaded = false;
+	if (!bLoaded)
+	{
+		bLoaded = true;
+		Instance.Load(GetDefaultFilePath());
+	}
+	return Instance;
+}
+
+FString FSlateIconBakedTable::GetDefaultFilePath()
+{
+	return FPaths::ProjectContentDir() / TEXT("SlateIconReference") / TEXT("BakedIcons.bin");
+}
+
+bool FSlateIconBakedTable::Load(const FString& InFilePath)
+{
+	Reset();
+
+	TArray<uint8> Bytes;
+	if (!IFileManager::Get().FileExists(*InFilePath) || !FFileHelper::LoadFileToArray(Bytes, *InFilePath))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+
+	uint32 Magic = 0, Version = 0;
+	Reader << Magic << Version;
+	if (Magic != SlateIconBakedTable::FileMagic || Version != SlateIconBakedTable::FileVersion)
+	{
+		return false;
+	}
+
+	TArray<FSlateIconMetadata> LoadedEntries;
+	Reader << LoadedEntries;
+	if (Reader.IsError())
+	{
+		return false;
+	}
+
+	for (const FSlateIconMetadata& Entry : LoadedEntries)
+	{
+		Add(Entry);
+	}
+	return true;
+}
+
+bool FSlateIconBakedTable::Save(const FString& InFilePath) const
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	uint32 Magic = SlateIconBakedTable::FileMagic;
+	uint32 Version = SlateIconBakedTable::FileVersion;
+	Writer << Magic << Version;
+
+	// same layout as TArray serialization, archive operator leaves entries untouched when saving
+	int32 NumEntries = Entries.Num();
+	Writer << NumEntries;
+	for (const FSlateIconMetadata& Entry : Entries)
+	{
+		Writer << const_cast<FSlateIconMetadata&>(Entry);
+	}
+
+	return FFileHelper::SaveArrayToFile(Bytes, *InFilePath);
+}
+
+void FSlateIconBakedTable::Reset()
+{
+	Entries.Empty();
+	EntryIndices.Empty();
+}
+
+void FSlateIconBakedTable::Add(const FSlateIconMetadata& InEntry)
+{
+	const FEntryKey Key(InEntry.StyleSetName, InEntry.IconName);
+	if (int32* Existing = EntryIndices.Find(Key))
+	{
+		Entries[*Existing] = InEntry;
+	}
+	else
+	{
+		EntryIndices.Add(Key, Entries.Add(InEntry));
+	}
+}
+
+const FSlateIconMetadata* FSlateIconBakedTable::Find(FName StyleSetName, FName IconName) const
+{
+	const int32* Found = EntryIndices.Find(FEntryKey(StyleSetName, IconName));
+	return Found ? &Entries[*Found] : nullptr;
+}
@@ -0,0 +1,51 @@
+﻿// Copyright 2025, Aquanox.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "SlateIconMetadata.h"
+#include "UObject/NameTypes.h"
+#include "Templates/UnrealTemplate.h"
+
+/**
+ * Table of resolved icon metadata produced by SlateIconBake commandlet
+ *
+ * Lets startup validation and layout pre-sizing be done without style registry lookups,
+ * see FSlateIconCatalog::FindIconMetadata and FSlateIconCatalog::ValidateBakedTable.
+ * Table is loaded from GetDefaultFilePath on first access, file needs to be staged for packaged builds:
+ * @code
+ * [/Script/UnrealEd.ProjectPackagingSettings]
+ * +DirectoriesToAlwaysStageAsUFS=(Path="SlateIconReference")
+ * @endcode
+ */
+class SLATEICONREFERENCE_API FSlateIconBakedTable : public FNoncopyable
+{
+public:
+	static FSlateIconBakedTable& Get();
+
+	/**
+	 * Location of the table within project content directory
+	 */
+	static FString GetDefaultFilePath();
+
+	bool Load(const FString& InFilePath);
+	bool Save(const FString& InFilePath) const;
+
+	void Reset();
+	void Add(const FSlateIconMetadata& InEntry);
+
+	/**
+	 * Find baked metadata of the icon, nullptr if icon was not baked
+	 */
+	const FSlateIconMetadata* Find(FName StyleSetName, FName IconName) const;
+
+	TConstArrayView<FSlateIconMetadata> GetEntries() const { return Entries; }
+	int32 Num() const { return Entries.Num(); }
+
+private:
+	using FEntryKey = TPair<FName, FName>;
+
+	TArray<FSlateIconMetadata> Entries;
+	TMap<FEntryKey, int32> EntryIndices;
+};
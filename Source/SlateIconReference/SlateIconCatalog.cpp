@@ -0,0 +1,301 @@
+﻿// Copyright 2025, Aquanox.
+
+#include "SlateIconCatalog.h"
+
+#include "SlateIconReference.h"
+#include "SlateIconBakedTable.h"
+#include "SlateIconMetadata.h"
+#include "SlateStyleSetAccess.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+#include "Misc/CString.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/StringBuilder.h"
+#include "HAL/IConsoleManager.h"
+#include "Styling/SlateStyle.h"
+#include "Styling/SlateStyleRegistry.h"
+
+namespace SlateIconCatalog
+{
+	// guard against malformed parent chains
+	constexpr int32 MaxInheritanceDepth = 32;
+
+	// case-insensitive comparison of name strings without heap allocations
+	static int32 CompareNames(const FName& A, const FName& B)
+	{
+		TStringBuilder<128> BuilderA, BuilderB;
+		A.AppendString(BuilderA);
+		B.AppendString(BuilderB);
+		return FCString::Stricmp(BuilderA.ToString(), BuilderB.ToString());
+	}
+
+	struct FNameLess
+	{
+		bool operator()(const FName& A, const FName& B) const { return CompareNames(A, B) < 0; }
+	};
+
+	// compares name against prefix, treating names starting with prefix as equal
+	static int32 ComparePrefix(const FName& Name, FStringView Prefix)
+	{
+		TStringBuilder<128> Builder;
+		Name.AppendString(Builder);
+		const int32 Len = FMath::Min(Builder.Len(), Prefix.Len());
+		const int32 Result = FCString::Strnicmp(Builder.ToString(), Prefix.GetData(), Len);
+		if (Result != 0)
+		{
+			return Result;
+		}
+		return Builder.Len() < Prefix.Len() ? -1 : 0;
+	}
+
+	// identity of registered style sets and their brush counts, independent of iteration order
+	static uint32 ComputeRegistryFingerprint()
+	{
+		uint32 Fingerprint = 0;
+		uint32 NumStyles = 0;
+		FSlateStyleRegistry::IterateAllStyles([&Fingerprint, &NumStyles](const ISlateStyle& Style)
+		{
+			const FSlateStyleSet& SlateStyleSet = static_cast<const FSlateStyleSet&>(Style);
+			uint32 StyleHash = HashCombine(GetTypeHash(Style.GetStyleSetName()), PointerHash(&Style));
+			StyleHash = HashCombine(StyleHash, GetTypeHash(FSlateStyleSetAccess::GetBrushResources(SlateStyleSet).Num()));
+			StyleHash = HashCombine(StyleHash, GetTypeHash(FSlateStyleSetAccess::GetParentStyleName(SlateStyleSet)));
+			Fingerprint += StyleHash;
+			++NumStyles;
+			return true;
+		});
+		return HashCombine(Fingerprint, NumStyles);
+	}
+}
+
+static FAutoConsoleCommandWithOutputDevice GValidateBakedIcons(
+	TEXT("SlateIconReference.ValidateBakedTable"),
+	TEXT("Compare baked icon table against registered style sets"),
+	FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Ar)
+	{
+		TArray<FSlateIconMetadata> Mismatches;
+		FSlateIconCatalog::Get().ValidateBakedTable(Mismatches);
+		for (const FSlateIconMetadata& Entry : Mismatches)
+		{
+			Ar.Logf(TEXT("Baked icon %s.%s (exists=%d, resource=%s) does not match registered brush"),
+				*Entry.StyleSetName.ToString(), *Entry.IconName.ToString(), Entry.bExists, *Entry.ResourceName.ToString());
+		}
+		Ar.Logf(TEXT("%d of %d baked icons mismatched"), Mismatches.Num(), FSlateIconBakedTable::Get().Num());
+	})
+);
+
+FSlateIconCatalog& FSlateIconCatalog::Get()
+{
+	static FSlateIconCatalog Instance;
+	return Instance;
+}
+
+void FSlateIconCatalog::Update()
+{
+	using namespace SlateIconCatalog;
+
+	const uint32 Generation = FSlateIconReference::GetStyleRegistryGeneration();
+	if (BuiltGeneration == Generation)
+	{
+		return;
+	}
+
+	// most module loads register no style sets, only rebuild when registered sets actually changed
+	const uint32 Fingerprint = ComputeRegistryFingerprint();
+	if (BuiltGeneration == 0 || Fingerprint != BuiltFingerprint)
+	{
+		Build();
+		BuiltFingerprint = Fingerprint;
+	}
+	BuiltGeneration = Generation;
+}
+
+void FSlateIconCatalog::Reset()
+{
+	BuiltGeneration = 0;
+	BuiltFingerprint = 0;
+	StyleSets.Empty();
+	StyleSetNames.Empty();
+	StyleSetIndices.Empty();
+	IconNames.Empty();
+}
+
+void FSlateIconCatalog::Build()
+{
+	using namespace SlateIconCatalog;
+
+	StyleSets.Reset();
+	StyleSetNames.Reset();
+	StyleSetIndices.Reset();
+	IconNames.Reset();
+
+	FSlateStyleRegistry::IterateAllStyles([this](const ISlateStyle& Style)
+	{
+		const FName StyleName = Style.GetStyleSetName();
+		if (StyleName.IsNone())
+		{
+			return true;
+		}
+
+		const FSlateStyleSet& SlateStyleSet = static_cast<const FSlateStyleSet&>(Style);
+
+		FStyleSetEntry& Entry = StyleSets.AddDefaulted_GetRef();
+		Entry.Name = StyleName;
+		Entry.ParentName = FSlateStyleSetAccess::GetParentStyleName(SlateStyleSet);
+		Entry.FirstIcon = IconNames.Num();
+
+		const TMap<FName, FSlateBrush*>& BrushResourcesMap = FSlateStyleSetAccess::GetBrushResources(SlateStyleSet);
+		IconNames.Reserve(IconNames.Num() + BrushResourcesMap.Num());
+		for (const auto& KeyToBrush : BrushResourcesMap)
+		{
+			if (!KeyToBrush.Key.IsNone() && KeyToBrush.Value)
+			{
+				IconNames.Add(KeyToBrush.Key);
+			}
+		}
+
+		Entry.NumIcons = IconNames.Num() - Entry.FirstIcon;
+		Algo::Sort(TArrayView<FName>(IconNames.GetData() + Entry.FirstIcon, Entry.NumIcons), FNameLess());
+		return true;
+	});
+
+	Algo::Sort(StyleSets, [](const FStyleSetEntry& A, const FStyleSetEntry& B)
+	{
+		return CompareNames(A.Name, B.Name) < 0;
+	});
+
+	StyleSetNames.Reserve(StyleSets.Num());
+	StyleSetIndices.Reserve(StyleSets.Num());
+	for (int32 Index = 0; Index < StyleSets.Num(); ++Index)
+	{
+		StyleSetNames.Add(StyleSets[Index].Name);
+		StyleSetIndices.Add(StyleSets[Index].Name, Index);
+	}
+
+	for (FStyleSetEntry& Entry : StyleSets)
+	{
+		Entry.ParentIndex = FindStyleSetIndex(Entry.ParentName);
+	}
+
+	IconNames.Shrink();
+}
+
+int32 FSlateIconCatalog::FindStyleSetIndex(FName StyleSetName) const
+{
+	if (StyleSetName.IsNone())
+	{
+		return INDEX_NONE;
+	}
+	const int32* Found = StyleSetIndices.Find(StyleSetName);
+	return Found ? *Found : INDEX_NONE;
+}
+
+TConstArrayView<FName> FSlateIconCatalog::GetIconRange(const FStyleSetEntry& Entry) const
+{
+	return TConstArrayView<FName>(IconNames.GetData() + Entry.FirstIcon, Entry.NumIcons);
+}
+
+TConstArrayView<FName> FSlateIconCatalog::GetStyleSetNames()
+{
+	Update();
+	return StyleSetNames;
+}
+
+bool FSlateIconCatalog::ContainsStyleSet(FName StyleSetName)
+{
+	Update();
+	return FindStyleSetIndex(StyleSetName) != INDEX_NONE;
+}
+
+FName FSlateIconCatalog::GetParentStyleSetName(FName StyleSetName)
+{
+	Update();
+	const int32 Index = FindStyleSetIndex(StyleSetName);
+	return Index != INDEX_NONE ? StyleSets[Index].ParentName : FName();
+}
+
+TConstArrayView<FName> FSlateIconCatalog::GetIconNames(FName StyleSetName)
+{
+	Update();
+	const int32 Index = FindStyleSetIndex(StyleSetName);
+	return Index != INDEX_NONE ? GetIconRange(StyleSets[Index]) : TConstArrayView<FName>();
+}
+
+bool FSlateIconCatalog::ContainsIcon(FName StyleSetName, FName IconName, bool bRecursive)
+{
+	using namespace SlateIconCatalog;
+
+	Update();
+
+	if (IconName.IsNone())
+	{
+		return false;
+	}
+
+	int32 Index = FindStyleSetIndex(StyleSetName);
+	for (int32 Depth = 0; Index != INDEX_NONE && Depth < MaxInheritanceDepth; ++Depth)
+	{
+		const FStyleSetEntry& Entry = StyleSets[Index];
+		if (Algo::BinarySearch(GetIconRange(Entry), IconName, FNameLess()) != INDEX_NONE)
+		{
+			return true;
+		}
+		Index = bRecursive ? Entry.ParentIndex : INDEX_NONE;
+	}
+	return false;
+}
+
+void FSlateIconCatalog::FindIconsWithPrefix(FName StyleSetName, FStringView Prefix, TArray<FName>& OutNames, bool bRecursive)
+{
+	using namespace SlateIconCatalog;
+
+	Update();
+
+	int32 Index = FindStyleSetIndex(StyleSetName);
+	for (int32 Depth = 0; Index != INDEX_NONE && Depth < MaxInheritanceDepth; ++Depth)
+	{
+		const FStyleSetEntry& Entry = StyleSets[Index];
+		const TConstArrayView<FName> Range = GetIconRange(Entry);
+
+		const int32 First = Algo::LowerBound(Range, Prefix, [](const FName& Name, FStringView InPrefix)
+		{
+			return ComparePrefix(Name, InPrefix) < 0;
+		});
+		for (int32 Item = First; Item < Range.Num() && ComparePrefix(Range[Item], Prefix) == 0; ++Item)
+		{
+			OutNames.Add(Range[Item]);
+		}
+
+		Index = bRecursive ? Entry.ParentIndex : INDEX_NONE;
+	}
+}
+
+bool FSlateIconCatalog::FindIconMetadata(FName StyleSetName, FName IconName, FSlateIconMetadata& OutMetadata)
+{
+	if (const FSlateIconMetadata* Baked = FSlateIconBakedTable::Get().Find(StyleSetName, IconName))
+	{
+		OutMetadata = *Baked;
+		return OutMetadata.bExists;
+	}
+
+	const ISlateStyle* StyleSet = ContainsIcon(StyleSetName, IconName) ? FSlateStyleRegistry::FindSlateStyle(StyleSetName) : nullptr;
+	OutMetadata = FSlateIconMetadata::Make(StyleSetName, IconName, StyleSet ? StyleSet->GetOptionalBrush(IconName, nullptr, nullptr) : nullptr);
+	return OutMetadata.bExists;
+}
+
+bool FSlateIconCatalog::ValidateBakedTable(TArray<FSlateIconMetadata>& OutMismatches)
+{
+	Update();
+
+	for (const FSlateIconMetadata& Entry : FSlateIconBakedTable::Get().GetEntries())
+	{
+		const ISlateStyle* StyleSet = ContainsIcon(Entry.StyleSetName, Entry.IconName) ? FSlateStyleRegistry::FindSlateStyle(Entry.StyleSetName) : nullptr;
+		const FSlateBrush* Brush = StyleSet ? StyleSet->GetOptionalBrush(Entry.IconName, nullptr, nullptr) : nullptr;
+
+		const bool bExists = Brush != nullptr;
+		if (bExists != Entry.bExists || (bExists && Brush->GetResourceName() != Entry.ResourceName))
+		{
+			OutMismatches.Add(Entry);
+		}
+	}
+	return OutMismatches.Num() == 0;
+}
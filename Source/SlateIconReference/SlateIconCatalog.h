@@ -0,0 +1,119 @@
+﻿// Copyright 2025, Aquanox.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Containers/Map.h"
+#include "Containers/StringView.h"
+#include "UObject/NameTypes.h"
+#include "Templates/UnrealTemplate.h"
+
+struct FSlateIconMetadata;
+
+/**
+ * Lightweight runtime catalog of registered style sets and their brushes
+ *
+ * Built lazily on first query. When style registry generation changes it is rebuilt only if
+ * registered style sets or their brush counts differ from the last build.
+ * Icon names of all style sets are kept in one contiguous array, each style set owning a sorted range of it.
+ * Must be used on game thread only.
+ *
+ * @code
+ * TArray<FName> Found;
+ * FSlateIconCatalog::Get().FindIconsWithPrefix(TEXT("EditorStyle"), TEXT("LevelEditor."), Found);
+ * @endcode
+ */
+class SLATEICONREFERENCE_API FSlateIconCatalog : public FNoncopyable
+{
+public:
+	static FSlateIconCatalog& Get();
+
+	/**
+	 * Rebuild catalog if registered style sets changed since last build
+	 */
+	void Update();
+
+	/**
+	 * Release catalog data, it will be built again on next query
+	 */
+	void Reset();
+
+	/**
+	 * Names of all known style sets, sorted alphabetically
+	 */
+	TConstArrayView<FName> GetStyleSetNames();
+
+	/**
+	 * Checks whether style set is known
+	 */
+	bool ContainsStyleSet(FName StyleSetName);
+
+	/**
+	 * Name of the parent style set, or None if style set has no parent or unknown
+	 */
+	FName GetParentStyleSetName(FName StyleSetName);
+
+	/**
+	 * Names of icons registered within style set itself, sorted alphabetically
+	 */
+	TConstArrayView<FName> GetIconNames(FName StyleSetName);
+
+	/**
+	 * Checks whether style set or optionally any of its parents contains icon
+	 */
+	bool ContainsIcon(FName StyleSetName, FName IconName, bool bRecursive = true);
+
+	/**
+	 * Find icons which names start with prefix (case-insensitive)
+	 *
+	 * @param StyleSetName Style set to search in
+	 * @param Prefix Icon name prefix, empty prefix matches all icons
+	 * @param OutNames Receives matching names, sorted alphabetically within each style set
+	 * @param bRecursive Whether to search in parent style sets as well
+	 */
+	void FindIconsWithPrefix(FName StyleSetName, FStringView Prefix, TArray<FName>& OutNames, bool bRecursive = false);
+
+	/**
+	 * Gets metadata of the icon for layout pre-sizing
+	 *
+	 * Baked table entries are used as is, other icons are resolved through the style registry.
+	 *
+	 * @return true if icon exists
+	 */
+	bool FindIconMetadata(FName StyleSetName, FName IconName, FSlateIconMetadata& OutMetadata);
+
+	/**
+	 * Compares baked icon table against registered style sets
+	 *
+	 * @param OutMismatches Receives baked entries which existence or resource differs from registered brushes
+	 * @return true if all baked entries match
+	 */
+	bool ValidateBakedTable(TArray<FSlateIconMetadata>& OutMismatches);
+
+private:
+	struct FStyleSetEntry
+	{
+		FName Name;
+		FName ParentName;
+		int32 ParentIndex = INDEX_NONE;
+		int32 FirstIcon = 0;
+		int32 NumIcons = 0;
+	};
+
+	void Build();
+	int32 FindStyleSetIndex(FName StyleSetName) const;
+	TConstArrayView<FName> GetIconRange(const FStyleSetEntry& Entry) const;
+
+	uint32 BuiltGeneration = 0;
+	uint32 BuiltFingerprint = 0;
+
+	// sorted by name
+	TArray<FStyleSetEntry> StyleSets;
+	// names of StyleSets, for array views
+	TArray<FName> StyleSetNames;
+	// name to index in StyleSets
+	TMap<FName, int32> StyleSetIndices;
+	// icon names of all style sets
+	TArray<FName> IconNames;
+};
@@ -0,0 +1,41 @@
+﻿// Copyright 2025, Aquanox.
+
+#include "SlateIconMetadata.h"
+
+#include "Styling/SlateBrush.h"
+
+FSlateIconMetadata FSlateIconMetadata::Make(FName InStyleSetName, FName InIconName, const FSlateBrush* InBrush)
+{
+	FSlateIconMetadata Entry;
+	Entry.StyleSetName = InStyleSetName;
+	Entry.IconName = InIconName;
+	if (InBrush)
+	{
+		Entry.bExists = true;
+		Entry.ResourceName = InBrush->GetResourceName();
+		Entry.ImageSize = InBrush->GetImageSize();
+		Entry.DrawType = static_cast<uint8>(InBrush->GetDrawType());
+		Entry.ImageType = static_cast<uint8>(InBrush->GetImageType());
+	}
+	return Entry;
+}
+
+FArchive& operator<<(FArchive& Ar, FSlateIconMetadata& Entry)
+{
+	Ar << Entry.StyleSetName;
+	Ar << Entry.IconName;
+	Ar << Entry.ResourceName;
+
+	float SizeX = static_cast<float>(Entry.ImageSize.X);
+	float SizeY = static_cast<float>(Entry.ImageSize.Y);
+	Ar << SizeX << SizeY;
+	if (Ar.IsLoading())
+	{
+		Entry.ImageSize = FVector2D(SizeX, SizeY);
+	}
+
+	Ar << Entry.DrawType;
+	Ar << Entry.ImageType;
+	Ar << Entry.bExists;
+	return Ar;
+}
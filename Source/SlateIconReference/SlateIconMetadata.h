@@ -0,0 +1,34 @@
+﻿// Copyright 2025, Aquanox.
+
+#pragma once
+
+#include "Math/Vector2D.h"
+#include "UObject/NameTypes.h"
+
+struct FSlateBrush;
+
+/**
+ * Resolved icon metadata that does not require style registry access to query
+ */
+struct SLATEICONREFERENCE_API FSlateIconMetadata
+{
+	FName		StyleSetName;
+	FName		IconName;
+	// resource name of the brush (texture path, svg path etc)
+	FName		ResourceName;
+	// image size of the brush
+	FVector2D	ImageSize = FVector2D::ZeroVector;
+	// ESlateBrushDrawType::Type of the brush
+	uint8		DrawType = 0;
+	// ESlateBrushImageType::Type of the brush
+	uint8		ImageType = 0;
+	// was icon found when resolved
+	bool		bExists = false;
+
+	/**
+	 * Capture metadata of the brush, nullptr brush produces metadata of a missing icon
+	 */
+	static FSlateIconMetadata Make(FName InStyleSetName, FName InIconName, const FSlateBrush* InBrush);
+
+	friend SLATEICONREFERENCE_API FArchive& operator<<(FArchive& Ar, FSlateIconMetadata& Entry);
+};
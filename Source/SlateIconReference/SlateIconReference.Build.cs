@@ -1,5 +1,6 @@
 ﻿//  Copyright 2025, Aquanox.
 
+using System.IO;
 using UnrealBuildTool;
 
 public class SlateIconReference : ModuleRules
@@ -18,6 +19,8 @@ public class SlateIconReference : ModuleRules
 		}
 
 		PublicIncludePaths.Add(ModuleDirectory);
+		// engine private access helpers, dependent modules use FSlateStyleSetAccess instead
+		PrivateIncludePaths.Add(Path.Combine(ModuleDirectory, "Private"));
 
 		PublicDependencyModuleNames.AddRange(new string[] {
 			"Core",
@@ -31,5 +34,9 @@ public class SlateIconReference : ModuleRules
 			"InputCore"
 		});
 
+		if (Target.Version.MajorVersion == 4 && CppStandard < CppStandardVersion.Cpp17)
+		{ // required for private access in 4.27
+			CppStandard = CppStandardVersion.Cpp17;
+		}
 	}
 }
@@ -1,16 +1,199 @@
 ﻿// Copyright 2025, Aquanox.
 
 #include "SlateIconReference.h"
+#include "SlateIconReferenceCustomVersion.h"
 #include "Modules/ModuleManager.h"
 #include "Misc/EngineVersionComparison.h"
 #include "Slate/SlateBrushAsset.h"
 #include "Styling/ISlateStyle.h"
 #include "Styling/SlateColor.h"
+#include "Styling/SlateStyleRegistry.h"
 #include "Styling/StyleDefaults.h"
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Rendering/SlateRenderer.h"
 
+#include "Serialization/CustomVersion.h"
 #include "UObject/Package.h"
 
-IMPLEMENT_MODULE(FDefaultModuleImpl, SlateIconReference);
+#include <atomic>
+
+const FGuid FSlateIconReferenceCustomVersion::GUID(0x5A3C17E2, 0x8B4D4F61, 0x9E0A2C7B, 0x41D6F3A8);
+static FCustomVersionRegistration GRegisterSlateIconReferenceCustomVersion(FSlateIconReferenceCustomVersion::GUID, FSlateIconReferenceCustomVersion::LatestVersion, TEXT("SlateIconReferenceVer"));
+
+// Presence mask for compact serialization
+namespace ESlateIconSerializeFlags
+{
+	enum Type : uint8
+	{
+		StyleSet		= 1 << 0,
+		Icon			= 1 << 1,
+		SmallIcon		= 1 << 2,
+		OverlayIcon		= 1 << 3,
+		// small icon is "<Icon>.Small" and is not written
+		DerivedSmallIcon= 1 << 4,
+
+		NumBits			= 5
+	};
+}
+
+static TAutoConsoleVariable<bool> CVarElideDerivedSmallIcon(
+	TEXT("SlateIconReference.ElideDerivedSmallIcon"),
+	false,
+	TEXT("If enabled, compact serialization does not write small icon names following the \"<Icon>.Small\" convention and restores them on load.\n")
+	TEXT("Data written either way loads regardless of this setting."));
+
+// Short text form separators
+namespace SlateIconTextFormat
+{
+	constexpr TCHAR StyleSeparator = TEXT(':');
+	constexpr TCHAR IconSeparator = TEXT('|');
+
+	static bool IsTokenChar(TCHAR InChar)
+	{
+		switch (InChar)
+		{
+		case TEXT('\0'):
+		case StyleSeparator:
+		case IconSeparator:
+		case TEXT(','):
+		case TEXT('('):
+		case TEXT(')'):
+		case TEXT('"'):
+			return false;
+		default:
+			return !FChar::IsWhitespace(InChar);
+		}
+	}
+
+	static bool CanExport(const FName& InName)
+	{
+		if (InName.IsNone())
+		{
+			return true;
+		}
+
+		TStringBuilder<128> Builder;
+		InName.AppendString(Builder);
+		for (const TCHAR* Cursor = Builder.ToString(); *Cursor; ++Cursor)
+		{
+			if (!IsTokenChar(*Cursor))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static FName ReadToken(const TCHAR*& Cursor)
+	{
+		const TCHAR* Start = Cursor;
+		while (IsTokenChar(*Cursor))
+		{
+			++Cursor;
+		}
+		return Cursor != Start ? FName(static_cast<int32>(Cursor - Start), Start) : FName();
+	}
+}
+
+// Pending time-sliced icon preloads
+namespace SlateIconPreload
+{
+	struct FRequest
+	{
+		TArray<FSlateIconReference> References;
+		int32 NextIndex = 0;
+		int32 MaxPerFrame = 0;
+		float DrawScale = 1.0f;
+		bool bCancelled = false;
+		// references often share brushes, each one is acquired once
+		TSet<const FSlateBrush*> VisitedBrushes;
+		FSimpleDelegate OnComplete;
+	};
+
+	static TArray<TSharedRef<FRequest>> PendingRequests;
+#if UE_VERSION_OLDER_THAN(5, 0, 0)
+	static FDelegateHandle TickHandle;
+#else
+	static FTSTicker::FDelegateHandle TickHandle;
+#endif
+
+	static void PreloadBrush(FRequest& Request, const FSlateBrush* InBrush)
+	{
+		if (!InBrush || InBrush->GetResourceName().IsNone())
+		{
+			return;
+		}
+
+		bool bAlreadyVisited = false;
+		Request.VisitedBrushes.Add(InBrush, &bAlreadyVisited);
+		if (bAlreadyVisited)
+		{
+			return;
+		}
+
+#if UE_VERSION_OLDER_THAN(5, 0, 0)
+		FSlateApplication::Get().GetRenderer()->GetResourceHandle(*InBrush);
+#else
+		// vector brushes are rasterized for the size they are drawn at
+		InBrush->GetRenderingResource(InBrush->GetImageSize(), Request.DrawScale);
+#endif
+	}
+
+	static void PreloadRange(FRequest& Request, int32 Count)
+	{
+		const int32 EndIndex = FMath::Min(Request.NextIndex + Count, Request.References.Num());
+		for (; Request.NextIndex < EndIndex; ++Request.NextIndex)
+		{
+			const FSlateIconReference& Reference = Request.References[Request.NextIndex];
+			if (Reference.IsSet())
+			{
+				PreloadBrush(Request, Reference.GetOptionalIcon());
+				PreloadBrush(Request, Reference.GetOptionalSmallIcon());
+				PreloadBrush(Request, Reference.GetOptionalOverlayIcon());
+			}
+		}
+	}
+
+	static bool Tick(float DeltaTime)
+	{
+		// requests may be added from completion callbacks
+		TArray<TSharedRef<FRequest>> Requests = PendingRequests;
+		for (const TSharedRef<FRequest>& Request : Requests)
+		{
+			if (Request->bCancelled)
+			{ // dropped by a completion callback of a previous request
+				continue;
+			}
+
+			if (FSlateApplication::IsInitialized())
+			{
+				PreloadRange(*Request, Request->MaxPerFrame);
+			}
+			else
+			{ // nothing to preload into, complete right away
+				Request->NextIndex = Request->References.Num();
+			}
+
+			if (Request->NextIndex >= Request->References.Num())
+			{
+				PendingRequests.Remove(Request);
+				Request->OnComplete.ExecuteIfBound();
+			}
+		}
+
+		if (PendingRequests.Num() == 0)
+		{
+			TickHandle.Reset();
+			return false;
+		}
+		return true;
+	}
+}
+
+// Generation of style registry, zero is reserved for "never resolved"
+static std::atomic<uint32> GStyleRegistryGeneration { 1 };
 
 #if !UE_VERSION_OLDER_THAN(5, 5, 0)
 // Use engine private access
@@ -53,6 +236,7 @@ FSlateIconReference& FSlateIconReference::operator=(const FSlateIcon& Other)
 	SmallIconName = Other.GetSmallStyleName();
 	// do some magic as engine did not expose accessor for 4th member
 	OverlayIconName = Internal_ReadOverlayFromIcon(Other);
+	ResetCachedResolution();
 	return *this;
 }
 
@@ -65,28 +249,377 @@ FSlateIcon FSlateIconReference::ToSlateIcon() const
 #endif
 }
 
+bool FSlateIconReference::Serialize(FArchive& Ar)
+{
+	Ar.UsingCustomVersion(FSlateIconReferenceCustomVersion::GUID);
+
+	if (Ar.IsTextFormat())
+	{ // keep text formats human-readable
+		return false;
+	}
+
+	if (Ar.IsLoading() && Ar.CustomVer(FSlateIconReferenceCustomVersion::GUID) < FSlateIconReferenceCustomVersion::CompactSerialization)
+	{ // data saved with tagged properties
+		return false;
+	}
+
+	SerializeCompact(Ar, false);
+	return true;
+}
+
+bool FSlateIconReference::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	SerializeCompact(Ar, true);
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+void FSlateIconReference::SerializeCompact(FArchive& Ar, bool bPackedMask)
+{
+	uint8 Flags = 0;
+	if (Ar.IsSaving())
+	{
+		Flags |= StyleSetName.IsNone() ? 0 : ESlateIconSerializeFlags::StyleSet;
+		Flags |= IconName.IsNone() ? 0 : ESlateIconSerializeFlags::Icon;
+		Flags |= OverlayIconName.IsNone() ? 0 : ESlateIconSerializeFlags::OverlayIcon;
+
+		if (!SmallIconName.IsNone())
+		{
+			const bool bDerived = CVarElideDerivedSmallIcon.GetValueOnAnyThread()
+				&& !IconName.IsNone() && SmallIconName == ISlateStyle::Join(IconName, ".Small");
+			Flags |= bDerived ? ESlateIconSerializeFlags::DerivedSmallIcon : ESlateIconSerializeFlags::SmallIcon;
+		}
+	}
+
+	if (bPackedMask)
+	{
+		Ar.SerializeBits(&Flags, ESlateIconSerializeFlags::NumBits);
+	}
+	else
+	{
+		Ar << Flags;
+	}
+
+	if (Ar.IsLoading())
+	{
+		StyleSetName = NAME_None;
+		IconName = NAME_None;
+		SmallIconName = NAME_None;
+		OverlayIconName = NAME_None;
+		ResetCachedResolution();
+	}
+
+	if (Flags & ESlateIconSerializeFlags::StyleSet)		Ar << StyleSetName;
+	if (Flags & ESlateIconSerializeFlags::Icon)			Ar << IconName;
+	if (Flags & ESlateIconSerializeFlags::SmallIcon)	Ar << SmallIconName;
+	if (Flags & ESlateIconSerializeFlags::OverlayIcon)	Ar << OverlayIconName;
+
+	if (Ar.IsLoading() && (Flags & ESlateIconSerializeFlags::DerivedSmallIcon))
+	{
+		SmallIconName = ISlateStyle::Join(IconName, ".Small");
+	}
+}
+
+bool FSlateIconReference::ExportTextItem(FString& ValueStr, const FSlateIconReference& DefaultValue, UObject* Parent, int32 PortFlags, UObject* ExportRootScope) const
+{
+	using namespace SlateIconTextFormat;
+
+	if ((PortFlags & (PPF_ExportCpp | PPF_Copy)) || StyleSetName.IsNone())
+	{ // clipboard keeps the long form readable by any text import
+		return false;
+	}
+
+	if (*this == DefaultValue)
+	{ // leave delta export of unchanged values to reflection
+		return false;
+	}
+
+	if (!CanExport(StyleSetName) || !CanExport(IconName) || !CanExport(SmallIconName) || !CanExport(OverlayIconName))
+	{
+		return false;
+	}
+
+	StyleSetName.AppendString(ValueStr);
+	ValueStr.AppendChar(StyleSeparator);
+	if (!IconName.IsNone())
+	{
+		IconName.AppendString(ValueStr);
+	}
+
+	if (!SmallIconName.IsNone() || !OverlayIconName.IsNone())
+	{
+		ValueStr.AppendChar(IconSeparator);
+		if (!SmallIconName.IsNone())
+		{
+			SmallIconName.AppendString(ValueStr);
+		}
+	}
+
+	if (!OverlayIconName.IsNone())
+	{
+		ValueStr.AppendChar(IconSeparator);
+		OverlayIconName.AppendString(ValueStr);
+	}
+
+	return true;
+}
+
+bool FSlateIconReference::ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText)
+{
+	using namespace SlateIconTextFormat;
+
+	const TCHAR* Cursor = Buffer;
+
+	const FName ParsedStyleSet = ReadToken(Cursor);
+	if (ParsedStyleSet.IsNone() || *Cursor != StyleSeparator)
+	{ // not a short form, let reflection handle it
+		return false;
+	}
+	++Cursor;
+
+	FName ParsedNames[3];
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(ParsedNames); ++Index)
+	{
+		if (Index > 0)
+		{
+			if (*Cursor != IconSeparator)
+			{
+				break;
+			}
+			++Cursor;
+		}
+		ParsedNames[Index] = ReadToken(Cursor);
+	}
+
+	StyleSetName = ParsedStyleSet;
+	IconName = ParsedNames[0];
+	SmallIconName = ParsedNames[1];
+	OverlayIconName = ParsedNames[2];
+	ResetCachedResolution();
+
+	Buffer = Cursor;
+	return true;
+}
+
+void FSlateIconReference::ResolveMany(TConstArrayView<FSlateIconReference> InReferences, TArrayView<const FSlateBrush*> OutBrushes, bool bOptional)
+{
+	ResolveMany(InReferences, OutBrushes, TArrayView<const FSlateBrush*>(), TArrayView<const FSlateBrush*>(), bOptional);
+}
+
+void FSlateIconReference::ResolveMany(TConstArrayView<FSlateIconReference> InReferences, TArrayView<const FSlateBrush*> OutIcons, TArrayView<const FSlateBrush*> OutSmallIcons, TArrayView<const FSlateBrush*> OutOverlayIcons, bool bOptional)
+{
+	check(OutIcons.Num() == 0 || InReferences.Num() == OutIcons.Num());
+	check(OutSmallIcons.Num() == 0 || InReferences.Num() == OutSmallIcons.Num());
+	check(OutOverlayIcons.Num() == 0 || InReferences.Num() == OutOverlayIcons.Num());
+
+	const FSlateBrush* const MissingBrush = bOptional ? nullptr : FStyleDefaults::GetNoBrush();
+
+	// references rarely use more than a few style sets, so a tiny linear table beats sorting or hashing
+	TArray<TPair<FName, const ISlateStyle*>, TInlineAllocator<8>> StyleBuckets;
+	int32 LastBucket = INDEX_NONE;
+
+	for (int32 Index = 0; Index < InReferences.Num(); ++Index)
+	{
+		const FSlateIconReference& Reference = InReferences[Index];
+
+		if (LastBucket == INDEX_NONE || StyleBuckets[LastBucket].Key != Reference.StyleSetName)
+		{
+			LastBucket = StyleBuckets.IndexOfByPredicate([&Reference](const TPair<FName, const ISlateStyle*>& Bucket)
+			{
+				return Bucket.Key == Reference.StyleSetName;
+			});
+
+			if (LastBucket == INDEX_NONE)
+			{
+				LastBucket = StyleBuckets.Emplace(Reference.StyleSetName, FSlateStyleRegistry::FindSlateStyle(Reference.StyleSetName));
+			}
+		}
+
+		const ISlateStyle* StyleSet = StyleBuckets[LastBucket].Value;
+		if (!StyleSet)
+		{
+			if (OutIcons.Num()) OutIcons[Index] = MissingBrush;
+			if (OutSmallIcons.Num()) OutSmallIcons[Index] = MissingBrush;
+			if (OutOverlayIcons.Num()) OutOverlayIcons[Index] = MissingBrush;
+			continue;
+		}
+
+		if (OutIcons.Num())
+		{
+			OutIcons[Index] = bOptional ? StyleSet->GetOptionalBrush(Reference.IconName, nullptr, nullptr) : StyleSet->GetBrush(Reference.IconName);
+		}
+
+		if (OutSmallIcons.Num())
+		{
+			// same naming convention as FSlateIcon
+			const FName SmallName = Reference.SmallIconName.IsNone() ? ISlateStyle::Join(Reference.IconName, ".Small") : Reference.SmallIconName;
+			OutSmallIcons[Index] = bOptional ? StyleSet->GetOptionalBrush(SmallName, nullptr, nullptr) : StyleSet->GetBrush(SmallName);
+		}
+
+		if (OutOverlayIcons.Num())
+		{
+			const FSlateBrush* Brush = Reference.OverlayIconName.IsNone() ? nullptr : StyleSet->GetOptionalBrush(Reference.OverlayIconName, nullptr, nullptr);
+			OutOverlayIcons[Index] = Brush ? Brush : MissingBrush;
+		}
+	}
+}
+
+void FSlateIconReference::PreloadIcons(TConstArrayView<FSlateIconReference> InReferences, int32 MaxReferencesPerFrame, FSimpleDelegate OnComplete, float DrawScale)
+{
+	using namespace SlateIconPreload;
+
+	check(IsInGameThread());
+
+	TSharedRef<FRequest> Request = MakeShared<FRequest>();
+	Request->References.Append(InReferences.GetData(), InReferences.Num());
+	Request->MaxPerFrame = MaxReferencesPerFrame;
+	Request->DrawScale = DrawScale;
+	Request->OnComplete = MoveTemp(OnComplete);
+
+	if (MaxReferencesPerFrame <= 0 || InReferences.Num() <= MaxReferencesPerFrame)
+	{
+		if (FSlateApplication::IsInitialized())
+		{
+			PreloadRange(*Request, Request->References.Num());
+		}
+		Request->OnComplete.ExecuteIfBound();
+		return;
+	}
+
+	PendingRequests.Add(Request);
+	if (!TickHandle.IsValid())
+	{
+#if UE_VERSION_OLDER_THAN(5, 0, 0)
+		TickHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&SlateIconPreload::Tick));
+#else
+		TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&SlateIconPreload::Tick));
+#endif
+	}
+}
+
+void FSlateIconReference::CancelPendingPreloads()
+{
+	using namespace SlateIconPreload;
+
+	if (TickHandle.IsValid())
+	{
+#if UE_VERSION_OLDER_THAN(5, 0, 0)
+		FTicker::GetCoreTicker().RemoveTicker(TickHandle);
+#else
+		FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+#endif
+		TickHandle.Reset();
+	}
+
+	for (const TSharedRef<FRequest>& Request : PendingRequests)
+	{
+		Request->bCancelled = true;
+	}
+	PendingRequests.Empty();
+}
+
+uint32 FSlateIconReference::GetStyleRegistryGeneration()
+{
+	return GStyleRegistryGeneration.load(std::memory_order_acquire);
+}
+
+void FSlateIconReference::NotifyStyleRegistryChanged()
+{
+	uint32 Generation = GStyleRegistryGeneration.load(std::memory_order_relaxed);
+	uint32 NextGeneration;
+	do
+	{
+		NextGeneration = (Generation + 1 == 0) ? 1 : Generation + 1;
+	}
+	while (!GStyleRegistryGeneration.compare_exchange_weak(Generation, NextGeneration, std::memory_order_acq_rel));
+}
+
+void FSlateIconReference::SetCachedResolution(bool bEnable)
+{
+	ResolvedCache.bEnabled = bEnable;
+	ResolvedCache.Generation = 0;
+}
+
+void FSlateIconReference::ResetCachedResolution() const
+{
+	ResolvedCache.Generation = 0;
+}
+
+const FSlateIconReference::FResolvedCache& FSlateIconReference::GetResolvedCache() const
+{
+	FResolvedCache& Cache = ResolvedCache;
+
+	// generation changes on every registration or unregistration, zero is never current
+	const uint32 Generation = GetStyleRegistryGeneration();
+	if (Cache.Generation != Generation)
+	{
+		const FSlateIcon SlateIcon = ToSlateIcon();
+		Cache.StyleSet = SlateIcon.GetStyleSet();
+		Cache.Icon = SlateIcon.GetOptionalIcon();
+		Cache.SmallIcon = SlateIcon.GetOptionalSmallIcon();
+#if UE_VERSION_OLDER_THAN(5, 0, 0)
+		Cache.OverlayIcon = Cache.StyleSet ? Cache.StyleSet->GetOptionalBrush(OverlayIconName, nullptr, nullptr) : nullptr;
+#else
+		Cache.OverlayIcon = SlateIcon.GetOverlayIcon();
+#endif
+		Cache.Generation = Generation;
+	}
+	return Cache;
+}
+
+const FSlateBrush* FSlateIconReference::GetFallbackBrush(const FSlateBrush* InBrush) const
+{
+	if (InBrush)
+	{
+		return InBrush;
+	}
+	// match FSlateIcon behavior: default brush of the style set or no brush if style set is missing
+	const ISlateStyle* StyleSet = ResolvedCache.StyleSet;
+	return StyleSet ? StyleSet->GetDefaultBrush() : FStyleDefaults::GetNoBrush();
+}
+
 const ISlateStyle* FSlateIconReference::GetStyleSet() const
 {
+	if (IsCachedResolution())
+	{
+		return GetResolvedCache().StyleSet;
+	}
 	return ToSlateIcon().GetStyleSet();
 }
 
 const FSlateBrush* FSlateIconReference::GetIcon() const
 {
+	if (IsCachedResolution())
+	{
+		return GetFallbackBrush(GetResolvedCache().Icon);
+	}
 	return ToSlateIcon().GetIcon();
 }
 
 const FSlateBrush* FSlateIconReference::GetOptionalIcon() const
 {
+	if (IsCachedResolution())
+	{
+		return GetResolvedCache().Icon;
+	}
 	return ToSlateIcon().GetOptionalIcon();
 }
 
 const FSlateBrush* FSlateIconReference::GetSmallIcon() const
 {
+	if (IsCachedResolution())
+	{
+		return GetFallbackBrush(GetResolvedCache().SmallIcon);
+	}
 	return ToSlateIcon().GetSmallIcon();
 }
 
 const FSlateBrush* FSlateIconReference::GetOptionalSmallIcon() const
 {
+	if (IsCachedResolution())
+	{
+		return GetResolvedCache().SmallIcon;
+	}
 	return ToSlateIcon().GetOptionalSmallIcon();
 }
 
@@ -98,9 +631,13 @@ const FSlateBrush* FSlateIconReference::GetOverlayIcon() const
 
 const FSlateBrush* FSlateIconReference::GetOptionalOverlayIcon() const
 {
+	if (IsCachedResolution())
+	{
+		return GetResolvedCache().OverlayIcon;
+	}
 #if UE_VERSION_OLDER_THAN(5, 0, 0)
 	const ISlateStyle* StyleSet = GetStyleSet();
-	return StyleSet ? StyleSet->GetOptionalBrush(OverlayIconName) : nullptr;
+	return StyleSet ? StyleSet->GetOptionalBrush(OverlayIconName, nullptr, nullptr) : nullptr;
 #else
 	return ToSlateIcon().GetOverlayIcon();
 #endif
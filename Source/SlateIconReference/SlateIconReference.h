@@ -25,21 +25,21 @@ class USlateBrushAsset;
  * FSlateIconReference CompactDisplayMode;
  * @endcode
  */
-USTRUCT()
+USTRUCT(BlueprintType)
 struct SLATEICONREFERENCE_API FSlateIconReference
 {
 	GENERATED_BODY()
 public:
-	UPROPERTY(EditAnywhere, Category=SlateIcon)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=SlateIcon)
 	FName StyleSetName;
 
-	UPROPERTY(EditAnywhere, Category=SlateIcon)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=SlateIcon)
 	FName IconName;
 
-	UPROPERTY(EditAnywhere, Category=SlateIcon)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=SlateIcon)
 	FName SmallIconName;
 
-	UPROPERTY(EditAnywhere, Category=SlateIcon)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=SlateIcon)
 	FName OverlayIconName;
 public:
 	/**
@@ -74,6 +74,52 @@ public:
 	 */
 	FSlateIcon ToSlateIcon() const;
 
+	/**
+	 * Resolves icons of multiple references at once.
+	 *
+	 * Style sets are looked up once per distinct style set name instead of once per reference,
+	 * which makes it preferable to calling GetIcon in a loop when building large lists.
+	 * Only the icon brush is resolved, use the overload taking small and overlay outputs for the other brushes.
+	 *
+	 * @param InReferences References to resolve.
+	 * @param OutBrushes Receives icon brush for each reference, must be same size as InReferences.
+	 * @param bOptional If true unresolved icons are nullptr, otherwise same fallbacks as GetIcon are used.
+	 * @see GetIcon, GetOptionalIcon
+	 */
+	static void ResolveMany(TConstArrayView<FSlateIconReference> InReferences, TArrayView<const FSlateBrush*> OutBrushes, bool bOptional = false);
+
+	/**
+	 * Resolves icon, small icon and overlay brushes of multiple references at once.
+	 *
+	 * Each output is either empty, in which case that brush is skipped, or same size as InReferences.
+	 * Results match GetIcon, GetSmallIcon and GetOverlayIcon (or their optional variants) of each reference.
+	 *
+	 * @param InReferences References to resolve.
+	 * @param OutIcons Receives icon brush for each reference.
+	 * @param OutSmallIcons Receives small icon brush for each reference.
+	 * @param OutOverlayIcons Receives overlay brush for each reference.
+	 * @param bOptional If true unresolved icons are nullptr, otherwise same fallbacks as the getters are used.
+	 */
+	static void ResolveMany(TConstArrayView<FSlateIconReference> InReferences, TArrayView<const FSlateBrush*> OutIcons, TArrayView<const FSlateBrush*> OutSmallIcons, TArrayView<const FSlateBrush*> OutOverlayIcons, bool bOptional = false);
+
+	/**
+	 * Acquires rendering resources of icons ahead of their first paint to avoid load hitches.
+	 *
+	 * Icon, small icon and overlay brushes of each reference are preloaded, brushes shared by several references once.
+	 * Must be called on game thread, does nothing if Slate application is not initialized.
+	 *
+	 * @param InReferences References to preload.
+	 * @param MaxReferencesPerFrame Number of references to process per frame, zero or less processes all immediately.
+	 * @param OnComplete Called once all references were processed.
+	 * @param DrawScale Scale icons will be drawn at, vector brushes are rasterized for their image size multiplied by it.
+	 */
+	static void PreloadIcons(TConstArrayView<FSlateIconReference> InReferences, int32 MaxReferencesPerFrame = 0, FSimpleDelegate OnComplete = FSimpleDelegate(), float DrawScale = 1.0f);
+
+	/**
+	 * Drops time-sliced preloads that are still in progress, their completion callbacks are not called.
+	 */
+	static void CancelPendingPreloads();
+
 	/**
 	 * Gets the resolved style set.
 	 *
@@ -161,4 +207,136 @@ public:
 	{
 		return StyleSetName != NAME_None && IconName != NAME_None;
 	}
+
+	bool operator==(const FSlateIconReference& Other) const
+	{
+		return StyleSetName == Other.StyleSetName
+			&& IconName == Other.IconName
+			&& SmallIconName == Other.SmallIconName
+			&& OverlayIconName == Other.OverlayIconName;
+	}
+
+	bool operator!=(const FSlateIconReference& Other) const
+	{
+		return !(*this == Other);
+	}
+
+	friend uint32 GetTypeHash(const FSlateIconReference& InValue)
+	{
+		uint32 Hash = GetTypeHash(InValue.StyleSetName);
+		Hash = HashCombine(Hash, GetTypeHash(InValue.IconName));
+		Hash = HashCombine(Hash, GetTypeHash(InValue.SmallIconName));
+		Hash = HashCombine(Hash, GetTypeHash(InValue.OverlayIconName));
+		return Hash;
+	}
+
+	/**
+	 * Native serialization, writes presence mask followed by non-None names only.
+	 *
+	 * With SlateIconReference.ElideDerivedSmallIcon enabled small icon name following the "<Icon>.Small"
+	 * convention is not written and restored from icon name, the mask records which form was used.
+	 * Data saved before this version is loaded with tagged property serialization.
+	 */
+	bool Serialize(FArchive& Ar);
+
+	/**
+	 * Network serialization, same layout as Serialize with mask packed into bits.
+	 */
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+	/**
+	 * Exports reference in short "Style:Icon|Small|Overlay" form, empty trailing names are omitted.
+	 *
+	 * Falls back to default long form if reference is empty, identical to DefaultValue, exported for C++ or
+	 * clipboard copy, or if names contain separator characters.
+	 */
+	bool ExportTextItem(FString& ValueStr, const FSlateIconReference& DefaultValue, UObject* Parent, int32 PortFlags, UObject* ExportRootScope) const;
+
+	/**
+	 * Imports reference in short "Style:Icon|Small|Overlay" form.
+	 *
+	 * Default long form "(StyleSetName=...,IconName=...)" is left to reflection.
+	 */
+	bool ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText);
+
+	/**
+	 * Enables or disables cached resolution mode.
+	 *
+	 * In cached mode resolved style set and brushes are stored within the reference and reused while style
+	 * registry generation stays the same, so repeated getter calls skip brush lookups.
+	 * Names must not be changed directly while cached mode is enabled without calling ResetCachedResolution.
+	 * Cache contents are not copied along with the reference, only the mode is.
+	 */
+	void SetCachedResolution(bool bEnable);
+
+	/**
+	 * Checks whether cached resolution mode is enabled.
+	 */
+	bool IsCachedResolution() const { return ResolvedCache.bEnabled; }
+
+	/**
+	 * Drops resolved values, next getter call will resolve them again.
+	 */
+	void ResetCachedResolution() const;
+
+	/**
+	 * Gets current generation of the style registry, changed every time style sets may have been registered or unregistered.
+	 */
+	static uint32 GetStyleRegistryGeneration();
+
+	/**
+	 * Marks style registry as changed, invalidating all cached resolutions.
+	 *
+	 * Called automatically on module load and unload and when set of registered style sets changes,
+	 * which is checked once per frame. Should be called manually right after unregistering a style set
+	 * outside of module unload or replacing brushes of a registered style set.
+	 */
+	static void NotifyStyleRegistryChanged();
+
+private:
+	/**
+	 * Resolved values for cached resolution mode
+	 */
+	struct FResolvedCache
+	{
+		bool bEnabled = false;
+		uint32 Generation = 0;
+		const ISlateStyle* StyleSet = nullptr;
+		const FSlateBrush* Icon = nullptr;
+		const FSlateBrush* SmallIcon = nullptr;
+		const FSlateBrush* OverlayIcon = nullptr;
+
+		FResolvedCache() = default;
+		// resolved values belong to the particular instance and never copied, only the mode is
+		FResolvedCache(const FResolvedCache& Other)
+			: bEnabled(Other.bEnabled)
+		{
+		}
+		FResolvedCache& operator=(const FResolvedCache& Other)
+		{
+			bEnabled = Other.bEnabled;
+			Generation = 0;
+			return *this;
+		}
+	};
+
+	void SerializeCompact(FArchive& Ar, bool bPackedMask);
+
+	const FResolvedCache& GetResolvedCache() const;
+	const FSlateBrush* GetFallbackBrush(const FSlateBrush* InBrush) const;
+
+	mutable FResolvedCache ResolvedCache;
+};
+
+template<>
+struct TStructOpsTypeTraits<FSlateIconReference> : public TStructOpsTypeTraitsBase2<FSlateIconReference>
+{
+	enum
+	{
+		WithIdenticalViaEquality = true,
+		WithSerializer = true,
+		WithNetSerializer = true,
+		WithExportTextItem = true,
+		WithImportTextItem = true,
+	};
 };
@@ -0,0 +1,29 @@
+﻿// Copyright 2025, Aquanox.
+
+#pragma once
+
+#include "Misc/Guid.h"
+
+/**
+ * Custom serialization version for FSlateIconReference
+ */
+struct SLATEICONREFERENCE_API FSlateIconReferenceCustomVersion
+{
+	enum Type
+	{
+		// Before any version changes were made, tagged property serialization
+		BeforeCustomVersionWasAdded = 0,
+		// Native serialization with presence mask and only non-None names
+		CompactSerialization,
+
+		// -----<new versions can be added above this line>-------------------------------------------------
+		VersionPlusOne,
+		LatestVersion = VersionPlusOne - 1
+	};
+
+	// The GUID for this custom version number
+	const static FGuid GUID;
+
+private:
+	FSlateIconReferenceCustomVersion() = delete;
+};
@@ -2,5 +2,53 @@
 
 #include "SlateIconReferenceLibrary.h"
 #include "Misc/EngineVersionComparison.h"
+#include "Styling/StyleDefaults.h"
 
+FSlateIconReference USlateIconReferenceLibrary::MakeSlateIconReference(FName StyleSetName, FName IconName, FName SmallIconName, FName OverlayIconName)
+{
+	return FSlateIconReference(StyleSetName, IconName, SmallIconName, OverlayIconName);
+}
 
+bool USlateIconReferenceLibrary::IsValidIconReference(const FSlateIconReference& Reference)
+{
+	return Reference.IsSet() && Reference.GetOptionalIcon() != nullptr;
+}
+
+FSlateBrush USlateIconReferenceLibrary::GetIconBrush(const FSlateIconReference& Reference)
+{
+	const FSlateBrush* Brush = Reference.GetOptionalIcon();
+	return Brush ? *Brush : *FStyleDefaults::GetNoBrush();
+}
+
+void USlateIconReferenceLibrary::ResolveIconBrushes(const TArray<FSlateIconReference>& References, TArray<FSlateBrush>& OutBrushes)
+{
+	TArray<const FSlateBrush*> Brushes;
+	Brushes.SetNumUninitialized(References.Num());
+	FSlateIconReference::ResolveMany(References, Brushes, /*bOptional=*/ true);
+
+	const FSlateBrush* NoBrush = FStyleDefaults::GetNoBrush();
+
+	OutBrushes.Reset(Brushes.Num());
+	for (const FSlateBrush* Brush : Brushes)
+	{
+		OutBrushes.Add(Brush ? *Brush : *NoBrush);
+	}
+}
+
+bool USlateIconReferenceLibrary::ValidateIconReferences(const TArray<FSlateIconReference>& References, TArray<int32>& OutInvalidIndices)
+{
+	TArray<const FSlateBrush*> Brushes;
+	Brushes.SetNumUninitialized(References.Num());
+	FSlateIconReference::ResolveMany(References, Brushes, /*bOptional=*/ true);
+
+	OutInvalidIndices.Reset();
+	for (int32 Index = 0; Index < References.Num(); ++Index)
+	{
+		if (!References[Index].IsSet() || !Brushes[Index])
+		{
+			OutInvalidIndices.Add(Index);
+		}
+	}
+
+	return OutInvalidIndices.Num() == 0;
+}
@@ -7,10 +7,44 @@
 #include "SlateIconReferenceLibrary.generated.h"
 
 /**
+ * Blueprint functions for working with FSlateIconReference
  *
+ * Array functions resolve the whole batch within a single native call.
  */
 UCLASS()
 class SLATEICONREFERENCE_API USlateIconReferenceLibrary : public UBlueprintFunctionLibrary
 {
 	GENERATED_BODY()
+public:
+	/**
+	 * Creates icon reference from names
+	 */
+	UFUNCTION(BlueprintPure, Category="Slate Icon Reference", meta=(AdvancedDisplay="SmallIconName,OverlayIconName"))
+	static FSlateIconReference MakeSlateIconReference(FName StyleSetName, FName IconName, FName SmallIconName, FName OverlayIconName);
+
+	/**
+	 * Checks whether reference is set and its icon exists
+	 */
+	UFUNCTION(BlueprintPure, Category="Slate Icon Reference")
+	static bool IsValidIconReference(const FSlateIconReference& Reference);
+
+	/**
+	 * Gets brush of the icon, or empty brush if the icon wasn't found
+	 */
+	UFUNCTION(BlueprintPure, Category="Slate Icon Reference")
+	static FSlateBrush GetIconBrush(const FSlateIconReference& Reference);
+
+	/**
+	 * Resolves icon brushes of all references, unresolved icons produce empty brush
+	 */
+	UFUNCTION(BlueprintCallable, Category="Slate Icon Reference")
+	static void ResolveIconBrushes(const TArray<FSlateIconReference>& References, TArray<FSlateBrush>& OutBrushes);
+
+	/**
+	 * Finds references that are not set or point to missing icons
+	 *
+	 * @return true if all references are valid
+	 */
+	UFUNCTION(BlueprintCallable, Category="Slate Icon Reference")
+	static bool ValidateIconReferences(const TArray<FSlateIconReference>& References, TArray<int32>& OutInvalidIndices);
 };
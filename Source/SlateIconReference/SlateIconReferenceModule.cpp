@@ -0,0 +1,85 @@
+﻿// Copyright 2025, Aquanox.
+
+#include "SlateIconReferenceModule.h"
+
+#include "Modules/ModuleManager.h"
+#include "SlateIconReference.h"
+#include "SlateIconCatalog.h"
+#include "SlateIconSnapshot.h"
+#include "Styling/SlateStyleRegistry.h"
+
+IMPLEMENT_MODULE(FSlateIconReferenceModule, SlateIconReference);
+
+// identity of registered style sets, independent of iteration order
+static uint32 ComputeRegisteredStylesHash()
+{
+	uint32 Hash = 0;
+	uint32 NumStyles = 0;
+	FSlateStyleRegistry::IterateAllStyles([&Hash, &NumStyles](const ISlateStyle& Style)
+	{
+		Hash += HashCombine(GetTypeHash(Style.GetStyleSetName()), PointerHash(&Style));
+		++NumStyles;
+		return true;
+	});
+	return HashCombine(Hash, NumStyles);
+}
+
+void FSlateIconReferenceModule::StartupModule()
+{
+	FModuleManager::Get().OnModulesChanged().AddRaw(this, &FSlateIconReferenceModule::HandleModulesChanged);
+
+	RegisteredStylesHash = ComputeRegisteredStylesHash();
+
+	// detect style sets unregistered outside of module unload every frame, cached resolutions must not outlive them
+	constexpr float TickInterval = 0.0f;
+#if UE_VERSION_OLDER_THAN(5, 0, 0)
+	TickHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FSlateIconReferenceModule::HandleTick), TickInterval);
+#else
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FSlateIconReferenceModule::HandleTick), TickInterval);
+#endif
+}
+
+void FSlateIconReferenceModule::ShutdownModule()
+{
+	FModuleManager::Get().OnModulesChanged().RemoveAll(this);
+
+#if UE_VERSION_OLDER_THAN(5, 0, 0)
+	FTicker::GetCoreTicker().RemoveTicker(TickHandle);
+#else
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+#endif
+
+	FSlateIconReference::CancelPendingPreloads();
+	FSlateIconSnapshot::Reset();
+	FSlateIconCatalog::Get().Reset();
+	FSlateIconReference::NotifyStyleRegistryChanged();
+}
+
+void FSlateIconReferenceModule::HandleModulesChanged(FName Name, EModuleChangeReason ModuleChangeReason)
+{
+	switch(ModuleChangeReason)
+	{
+	case EModuleChangeReason::ModuleLoaded:
+	case EModuleChangeReason::ModuleUnloaded:
+		// style sets are generally registered and unregistered along with owning modules
+		FSlateIconReference::NotifyStyleRegistryChanged();
+		break;
+	default:
+	case EModuleChangeReason::PluginDirectoryChanged:
+		break;
+	}
+}
+
+bool FSlateIconReferenceModule::HandleTick(float DeltaTime)
+{
+	const uint32 StylesHash = ComputeRegisteredStylesHash();
+	if (StylesHash != RegisteredStylesHash)
+	{
+		RegisteredStylesHash = StylesHash;
+		FSlateIconReference::NotifyStyleRegistryChanged();
+	}
+
+	// republish worker thread snapshot after registry changes
+	FSlateIconSnapshot::Update();
+	return true;
+}
@@ -0,0 +1,26 @@
+﻿// Copyright 2025, Aquanox.
+
+#pragma once
+
+#include "Containers/Ticker.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Modules/ModuleInterface.h"
+#include "Modules/ModuleManager.h"
+
+class SLATEICONREFERENCE_API FSlateIconReferenceModule : public IModuleInterface
+{
+public:
+    virtual void StartupModule() override;
+    virtual void ShutdownModule() override;
+
+    void HandleModulesChanged(FName Name, EModuleChangeReason ModuleChangeReason);
+    bool HandleTick(float DeltaTime);
+private:
+#if UE_VERSION_OLDER_THAN(5, 0, 0)
+    FDelegateHandle TickHandle;
+#else
+    FTSTicker::FDelegateHandle TickHandle;
+#endif
+    // registered style sets seen on last tick
+    uint32 RegisteredStylesHash = 0;
+};
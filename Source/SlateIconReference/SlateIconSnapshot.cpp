@@ -0,0 +1,162 @@
+﻿// Copyright 2025, Aquanox.
+
+#include "SlateIconSnapshot.h"
+
+#include "SlateIconCatalog.h"
+#include "SlateIconReference.h"
+#include "Misc/ScopeRWLock.h"
+#include "Styling/SlateStyleRegistry.h"
+#include <atomic>
+
+namespace SlateIconSnapshot
+{
+	// guard against malformed parent chains
+	constexpr int32 MaxInheritanceDepth = 32;
+
+	using FSnapshotPtr = TSharedPtr<const FSlateIconSnapshot, ESPMode::ThreadSafe>;
+
+	// written by game thread, copied out by any thread under the lock
+	static FSnapshotPtr Current;
+	static FRWLock CurrentLock;
+
+	static std::atomic<bool> bRequested { false };
+
+	static FSnapshotPtr CopyCurrent()
+	{
+		FReadScopeLock ReadLock(CurrentLock);
+		return Current;
+	}
+
+	static void SwapCurrent(FSnapshotPtr& InOutSnapshot)
+	{
+		{
+			FWriteScopeLock WriteLock(CurrentLock);
+			Swap(Current, InOutSnapshot);
+		}
+		// previous snapshot is released outside of the lock, readers may still hold their own references
+		InOutSnapshot.Reset();
+	}
+}
+
+FSlateIconSnapshot::FSnapshotRef FSlateIconSnapshot::Get()
+{
+	using namespace SlateIconSnapshot;
+
+	bRequested.store(true, std::memory_order_relaxed);
+
+	if (IsInGameThread())
+	{ // publish synchronously instead of handing out an empty or outdated snapshot
+		Update();
+	}
+
+	if (FSnapshotPtr Snapshot = CopyCurrent())
+	{
+		return Snapshot.ToSharedRef();
+	}
+
+	// nothing published yet, share an empty one
+	static const FSnapshotRef Empty = MakeShared<FSlateIconSnapshot, ESPMode::ThreadSafe>();
+	return Empty;
+}
+
+void FSlateIconSnapshot::Update()
+{
+	using namespace SlateIconSnapshot;
+
+	check(IsInGameThread());
+
+	if (!bRequested.load(std::memory_order_relaxed))
+	{
+		return;
+	}
+
+	// only game thread writes, reading without the lock is fine here
+	const uint32 PublishedGeneration = Current.IsValid() ? Current->Generation : 0;
+	if (PublishedGeneration != FSlateIconReference::GetStyleRegistryGeneration())
+	{
+		Publish();
+	}
+}
+
+void FSlateIconSnapshot::Reset()
+{
+	using namespace SlateIconSnapshot;
+
+	check(IsInGameThread());
+
+	bRequested.store(false, std::memory_order_relaxed);
+
+	FSnapshotPtr Released;
+	SwapCurrent(Released);
+}
+
+void FSlateIconSnapshot::Publish()
+{
+	using namespace SlateIconSnapshot;
+
+	TSharedRef<FSlateIconSnapshot, ESPMode::ThreadSafe> Snapshot = MakeShared<FSlateIconSnapshot, ESPMode::ThreadSafe>();
+	Snapshot->Generation = FSlateIconReference::GetStyleRegistryGeneration();
+
+	FSlateIconCatalog& Catalog = FSlateIconCatalog::Get();
+	for (const FName& StyleSetName : Catalog.GetStyleSetNames())
+	{
+		Snapshot->StyleSets.Add(StyleSetName, Catalog.GetParentStyleSetName(StyleSetName));
+
+		const ISlateStyle* StyleSet = FSlateStyleRegistry::FindSlateStyle(StyleSetName);
+		if (!StyleSet)
+		{
+			continue;
+		}
+
+		for (const FName& IconName : Catalog.GetIconNames(StyleSetName))
+		{
+			const FSlateBrush* Brush = StyleSet->GetOptionalBrush(IconName, nullptr, nullptr);
+			Snapshot->Icons.Add(FIconKey(StyleSetName, IconName), FSlateIconMetadata::Make(StyleSetName, IconName, Brush));
+		}
+	}
+
+	FSnapshotPtr Published = Snapshot;
+	SwapCurrent(Published);
+}
+
+bool FSlateIconSnapshot::ContainsStyleSet(FName StyleSetName) const
+{
+	return StyleSets.Contains(StyleSetName);
+}
+
+const FSlateIconMetadata* FSlateIconSnapshot::FindIcon(FName StyleSetName, FName IconName) const
+{
+	if (IconName.IsNone())
+	{
+		return nullptr;
+	}
+
+	for (int32 Depth = 0; !StyleSetName.IsNone() && Depth < SlateIconSnapshot::MaxInheritanceDepth; ++Depth)
+	{
+		if (const FSlateIconMetadata* Found = Icons.Find(FIconKey(StyleSetName, IconName)))
+		{
+			return Found;
+		}
+
+		const FName* ParentName = StyleSets.Find(StyleSetName);
+		StyleSetName = ParentName ? *ParentName : FName();
+	}
+	return nullptr;
+}
+
+bool FSlateIconSnapshot::IsValidReference(const FSlateIconReference& Reference) const
+{
+	if (!Reference.IsSet() || !FindIcon(Reference.StyleSetName, Reference.IconName))
+	{
+		return false;
+	}
+	if (!Reference.SmallIconName.IsNone() && !FindIcon(Reference.StyleSetName, Reference.SmallIconName))
+	{
+		return false;
+	}
+	if (!Reference.OverlayIconName.IsNone() && !FindIcon(Reference.StyleSetName, Reference.OverlayIconName))
+	{
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,79 @@
+﻿// Copyright 2025, Aquanox.
+
+#pragma once
+
+#include "Containers/Map.h"
+#include "SlateIconMetadata.h"
+#include "Templates/SharedPointer.h"
+#include "Templates/UnrealTemplate.h"
+
+struct FSlateIconReference;
+
+/**
+ * Immutable snapshot of registered style sets and their brushes metadata
+ *
+ * Unlike FSlateIconReference getters, snapshot can be queried from any thread.
+ * Current snapshot is rebuilt on game thread after style registry changes and swapped as a whole,
+ * acquiring it copies a shared reference under a short read lock. Workers keep using the snapshot they acquired until they acquire a new one.
+ *
+ * @code
+ * TSharedRef<const FSlateIconSnapshot, ESPMode::ThreadSafe> Snapshot = FSlateIconSnapshot::Get();
+ * if (Snapshot->IsValidReference(Reference)) { ... }
+ * @endcode
+ */
+class SLATEICONREFERENCE_API FSlateIconSnapshot : public FNoncopyable
+{
+public:
+	using FSnapshotRef = TSharedRef<const FSlateIconSnapshot, ESPMode::ThreadSafe>;
+
+	/**
+	 * Acquire current snapshot, safe to call from any thread.
+	 *
+	 * First call enables snapshot publishing. On game thread snapshot is brought up to date before returning,
+	 * on other threads an empty one is returned until game thread publishes the first snapshot.
+	 */
+	static FSnapshotRef Get();
+
+	/**
+	 * Rebuild and publish snapshot if style registry changed since last publish. Game thread only.
+	 */
+	static void Update();
+
+	/**
+	 * Release current snapshot and stop publishing until requested again. Game thread only.
+	 */
+	static void Reset();
+
+	/**
+	 * Style registry generation this snapshot was built for
+	 */
+	uint32 GetGeneration() const { return Generation; }
+
+	/**
+	 * Checks whether style set was registered
+	 */
+	bool ContainsStyleSet(FName StyleSetName) const;
+
+	/**
+	 * Find metadata of the icon within style set or its parents
+	 */
+	const FSlateIconMetadata* FindIcon(FName StyleSetName, FName IconName) const;
+
+	/**
+	 * Checks whether reference is set and all of its icons exist
+	 */
+	bool IsValidReference(const FSlateIconReference& Reference) const;
+
+	int32 NumIcons() const { return Icons.Num(); }
+
+private:
+	static void Publish();
+
+	using FIconKey = TPair<FName, FName>;
+
+	uint32 Generation = 0;
+	// style set name to parent style set name
+	TMap<FName, FName> StyleSets;
+	// icons registered within each style set
+	TMap<FIconKey, FSlateIconMetadata> Icons;
+};
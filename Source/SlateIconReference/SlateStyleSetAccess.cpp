@@ -0,0 +1,36 @@
+﻿// Copyright 2025, Aquanox.
+
+#include "SlateStyleSetAccess.h"
+
+#include "PrivateAccessHelper.h"
+#include "Brushes/SlateDynamicImageBrush.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Styling/SlateStyle.h"
+
+using FBrushResourcesMap = TMap<FName, FSlateBrush*>;
+UE_DEFINE_PRIVATE_MEMBER_PTR(FBrushResourcesMap, GBrushResources, FSlateStyleSet, BrushResources);
+using FDynamicBrushResourceMap = TMap<FName, TWeakPtr<FSlateDynamicImageBrush>>;
+UE_DEFINE_PRIVATE_MEMBER_PTR(FDynamicBrushResourceMap, GDynamicBrushResources, FSlateStyleSet, DynamicBrushes);
+
+#if !UE_VERSION_OLDER_THAN(5,0,0)
+UE_DEFINE_PRIVATE_MEMBER_PTR(FName, GParentStyleName, FSlateStyleSet, ParentStyleName);
+#endif
+
+const TMap<FName, FSlateBrush*>& FSlateStyleSetAccess::GetBrushResources(const FSlateStyleSet& StyleSet)
+{
+	return StyleSet.*GBrushResources;
+}
+
+const TMap<FName, TWeakPtr<FSlateDynamicImageBrush>>& FSlateStyleSetAccess::GetDynamicBrushes(const FSlateStyleSet& StyleSet)
+{
+	return StyleSet.*GDynamicBrushResources;
+}
+
+FName FSlateStyleSetAccess::GetParentStyleName(const FSlateStyleSet& StyleSet)
+{
+#if !UE_VERSION_OLDER_THAN(5,0,0)
+	return StyleSet.*GParentStyleName;
+#else
+	return NAME_None;
+#endif
+}
@@ -0,0 +1,34 @@
+﻿// Copyright 2025, Aquanox.
+
+#pragma once
+
+#include "Containers/Map.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/NameTypes.h"
+
+class FSlateStyleSet;
+struct FSlateBrush;
+struct FSlateDynamicImageBrush;
+
+/**
+ * Read access to FSlateStyleSet members the engine does not expose
+ *
+ * Private member access is confined to the runtime module, dependent modules go through these functions.
+ */
+struct SLATEICONREFERENCE_API FSlateStyleSetAccess
+{
+	/**
+	 * Brushes registered within the style set, without its parents
+	 */
+	static const TMap<FName, FSlateBrush*>& GetBrushResources(const FSlateStyleSet& StyleSet);
+
+	/**
+	 * Brushes created on demand from image files, held weakly by the style set
+	 */
+	static const TMap<FName, TWeakPtr<FSlateDynamicImageBrush>>& GetDynamicBrushes(const FSlateStyleSet& StyleSet);
+
+	/**
+	 * Name of the parent style set, always None before UE5
+	 */
+	static FName GetParentStyleName(const FSlateStyleSet& StyleSet);
+};
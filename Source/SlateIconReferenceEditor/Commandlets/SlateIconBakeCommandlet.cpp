@@ -0,0 +1,108 @@
+﻿// Copyright 2025, Aquanox.
+
+#include "SlateIconBakeCommandlet.h"
+
+#include "SlateIconReference.h"
+#include "SlateIconBakedTable.h"
+#include "Internal/SlateIconRefAccessor.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Modules/ModuleManager.h"
+#include "Styling/SlateStyleRegistry.h"
+#include "UObject/UObjectIterator.h"
+#include "UObject/UnrealType.h"
+
+#if !UE_VERSION_OLDER_THAN(5, 0, 0)
+#include "AssetRegistry/AssetRegistryModule.h"
+#else
+#include "AssetRegistryModule.h"
+#endif
+
+USlateIconBakeCommandlet::USlateIconBakeCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 USlateIconBakeCommandlet::Main(const FString& Params)
+{
+	FString OutputPath = FSlateIconBakedTable::GetDefaultFilePath();
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	if (FParse::Param(*Params, TEXT("LoadAssets")))
+	{
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		AssetRegistry.SearchAllAssets(true);
+
+		TArray<FAssetData> Assets;
+		AssetRegistry.GetAssetsByPath(TEXT("/Game"), Assets, true);
+
+		UE_LOG(LogSlateIcon, Display, TEXT("Loading %d assets"), Assets.Num());
+		for (const FAssetData& Asset : Assets)
+		{
+			Asset.GetAsset();
+		}
+	}
+
+	// gather every icon name referenced along with first owner for reporting
+	TMap<TPair<FName, FName>, FString> ReferencedIcons;
+
+	UScriptStruct* const ReferenceStruct = FSlateIconReference::StaticStruct();
+	for (TObjectIterator<UObject> It(RF_NoFlags); It; ++It)
+	{
+		UObject* const Object = *It;
+		for (TPropertyValueIterator<FStructProperty> PropIt(Object->GetClass(), Object); PropIt; ++PropIt)
+		{
+			if (PropIt.Key()->Struct != ReferenceStruct)
+			{
+				continue;
+			}
+
+			const FSlateIconReference& Reference = *static_cast<const FSlateIconReference*>(PropIt.Value());
+			if (Reference.StyleSetName.IsNone())
+			{
+				continue;
+			}
+
+			for (const FName& IconName : { Reference.IconName, Reference.SmallIconName, Reference.OverlayIconName })
+			{
+				if (!IconName.IsNone() && !ReferencedIcons.Contains(MakeTuple(Reference.StyleSetName, IconName)))
+				{
+					ReferencedIcons.Add(MakeTuple(Reference.StyleSetName, IconName), Object->GetPathName());
+				}
+			}
+		}
+	}
+
+	FSlateIconBakedTable Table;
+	int32 NumMissing = 0;
+
+	for (const auto& KeyToOwner : ReferencedIcons)
+	{
+		const FName StyleSetName = KeyToOwner.Key.Key;
+		const FName IconName = KeyToOwner.Key.Value;
+
+		const ISlateStyle* StyleSet = FSlateStyleRegistry::FindSlateStyle(StyleSetName);
+		const FSlateBrush* Brush = StyleSet ? StyleSet->GetOptionalBrush(IconName, nullptr, nullptr) : nullptr;
+
+		const FSlateIconMetadata Entry = FSlateIconMetadata::Make(StyleSetName, IconName, Brush);
+		if (!Entry.bExists)
+		{
+			++NumMissing;
+			UE_LOG(LogSlateIcon, Warning, TEXT("Missing icon %s.%s referenced by %s"),
+				*Entry.StyleSetName.ToString(), *Entry.IconName.ToString(), *KeyToOwner.Value);
+		}
+
+		Table.Add(Entry);
+	}
+
+	if (!Table.Save(OutputPath))
+	{
+		UE_LOG(LogSlateIcon, Error, TEXT("Failed to write baked icon table to %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogSlateIcon, Display, TEXT("Baked %d icons (%d missing) to %s"), Table.Num(), NumMissing, *OutputPath);
+	return 0;
+}
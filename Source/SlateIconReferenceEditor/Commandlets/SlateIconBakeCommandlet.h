@@ -0,0 +1,26 @@
+﻿// Copyright 2025, Aquanox.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "SlateIconBakeCommandlet.generated.h"
+
+/**
+ * Walks FSlateIconReference values of the project and writes resolved icon metadata table
+ *
+ * Missing icons are reported as warnings. Intended to be run before cooking:
+ * @code
+ * UnrealEditor-Cmd.exe Project.uproject -run=SlateIconBake [-LoadAssets] [-Output=Path]
+ * @endcode
+ * -LoadAssets loads all assets under /Game to include references stored in assets, not only class defaults and settings.
+ * -Output overrides location of the table, FSlateIconBakedTable::GetDefaultFilePath by default.
+ */
+UCLASS()
+class USlateIconBakeCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+public:
+	USlateIconBakeCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,130 @@
+﻿// Copyright 2025, Aquanox.
+
+#include "SlateIconNameFilter.h"
+
+#include "Algo/Sort.h"
+#include "Misc/Crc.h"
+#include "Misc/StringBuilder.h"
+
+void FSlateIconNameFilter::FRuleSet::Add(const FString& Pattern)
+{
+	const int32 NumWildcards = Pattern.Len() - Pattern.Replace(TEXT("*"), TEXT("")).Len();
+	const bool bHasSingleWildcard = Pattern.Contains(TEXT("?"));
+
+	if (NumWildcards == 0 && !bHasSingleWildcard)
+	{
+		Names.Add(FName(*Pattern));
+	}
+	else if (NumWildcards == 1 && !bHasSingleWildcard && Pattern.EndsWith(TEXT("*")))
+	{
+		Prefixes.Add(Pattern.LeftChop(1));
+	}
+	else if (NumWildcards == 1 && !bHasSingleWildcard && Pattern.StartsWith(TEXT("*")))
+	{
+		Suffixes.Add(Pattern.RightChop(1));
+	}
+	else
+	{
+		Wildcards.Add(Pattern);
+	}
+}
+
+bool FSlateIconNameFilter::FRuleSet::Matches(FName Name, const TCHAR* Str, int32 Len) const
+{
+	if (Names.Contains(Name))
+	{
+		return true;
+	}
+
+	for (const FString& Prefix : Prefixes)
+	{
+		if (Len >= Prefix.Len() && FCString::Strnicmp(Str, *Prefix, Prefix.Len()) == 0)
+		{
+			return true;
+		}
+	}
+
+	for (const FString& Suffix : Suffixes)
+	{
+		if (Len >= Suffix.Len() && FCString::Stricmp(Str + Len - Suffix.Len(), *Suffix) == 0)
+		{
+			return true;
+		}
+	}
+
+	if (Wildcards.Num())
+	{
+		const FString NameString(Len, Str);
+		for (const FString& Wildcard : Wildcards)
+		{
+			if (NameString.MatchesWildcard(Wildcard))
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+void FSlateIconNameFilter::Compile(const TArray<FString>& IncludePatterns, const TArray<FString>& ExcludePatterns)
+{
+	Reset();
+
+	RulesHash = FCrc::StrCrc32(TEXT("SlateIconNameFilter"));
+
+	auto AddRules = [this](FRuleSet& Rules, const TArray<FString>& Patterns)
+	{
+		TArray<FString> HashedPatterns;
+		for (const FString& RawPattern : Patterns)
+		{
+			const FString Pattern = RawPattern.TrimStartAndEnd();
+			if (!Pattern.IsEmpty())
+			{
+				Rules.Add(Pattern);
+				HashedPatterns.AddUnique(Pattern.ToLower());
+			}
+		}
+
+		// same rules listed in another order or repeated match the same names
+		Algo::Sort(HashedPatterns);
+		for (const FString& Pattern : HashedPatterns)
+		{
+			RulesHash = HashCombine(RulesHash, FCrc::StrCrc32(*Pattern));
+		}
+		// keeps identical patterns moved between lists from hashing the same
+		RulesHash = HashCombine(RulesHash, ::GetTypeHash(HashedPatterns.Num()));
+	};
+
+	AddRules(Include, IncludePatterns);
+	AddRules(Exclude, ExcludePatterns);
+}
+
+void FSlateIconNameFilter::Reset()
+{
+	Include = FRuleSet();
+	Exclude = FRuleSet();
+	RulesHash = 0;
+}
+
+bool FSlateIconNameFilter::PassesFilter(FName Name) const
+{
+	if (IsEmpty())
+	{
+		return true;
+	}
+
+	// name string is built only when some rule needs it
+	TStringBuilder<128> Builder;
+	if (Include.NeedsString() || Exclude.NeedsString())
+	{
+		Name.AppendString(Builder);
+	}
+
+	if (!Include.IsEmpty() && !Include.Matches(Name, Builder.ToString(), Builder.Len()))
+	{
+		return false;
+	}
+
+	return !Exclude.Matches(Name, Builder.ToString(), Builder.Len());
+}
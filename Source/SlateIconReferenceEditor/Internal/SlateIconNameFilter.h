@@ -0,0 +1,46 @@
+﻿// Copyright 2025, Aquanox.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/Set.h"
+#include "Containers/UnrealString.h"
+#include "UObject/NameTypes.h"
+
+/**
+ * Include and exclude name rules compiled once into lookup tables.
+ *
+ * Patterns without wildcards are matched by name, "Prefix*" and "*Suffix" by plain string comparison,
+ * anything else falls back to wildcard matching. All comparisons are case insensitive.
+ */
+class FSlateIconNameFilter
+{
+public:
+	void Compile(const TArray<FString>& IncludePatterns, const TArray<FString>& ExcludePatterns);
+	void Reset();
+
+	// true when no include rule is set or any include rule matches, and no exclude rule matches
+	bool PassesFilter(FName Name) const;
+	bool IsEmpty() const { return Include.IsEmpty() && Exclude.IsEmpty(); }
+
+	// stable between sessions, changes whenever rules change
+	uint32 GetRulesHash() const { return RulesHash; }
+
+private:
+	struct FRuleSet
+	{
+		TSet<FName> Names;
+		TArray<FString> Prefixes;
+		TArray<FString> Suffixes;
+		TArray<FString> Wildcards;
+
+		void Add(const FString& Pattern);
+		bool IsEmpty() const { return Names.Num() == 0 && !NeedsString(); }
+		bool NeedsString() const { return Prefixes.Num() || Suffixes.Num() || Wildcards.Num(); }
+		bool Matches(FName Name, const TCHAR* Str, int32 Len) const;
+	};
+
+	FRuleSet Include;
+	FRuleSet Exclude;
+	uint32 RulesHash = 0;
+};
@@ -15,7 +15,7 @@ struct FSlateStyleSetDescriptor;
 
 namespace Switches
 {
-	// dev switch to update on tick instead of on event
+	// dev switch to watch property value on tick instead of on event, catalog changes are always events
 	constexpr bool bRealtimeUpdates = true;
 }
 
@@ -4,159 +4,1367 @@
 
 #include "IPropertyTypeCustomization.h"
 #include "Misc/ConfigCacheIni.h"
-#include "PrivateAccessHelper.h"
 #include "PropertyHandle.h"
 #include "SlateIconRefAccessor.h"
 #include "SlateStyleHelper.h"
+#include "SlateStyleSetAccess.h"
 #include "Styling/SlateStyleRegistry.h"
+#include "Brushes/SlateDynamicImageBrush.h"
 #include "Widgets/DeclarativeSyntaxSupport.h"
 #include "Widgets/SToolTip.h"
 #include "Algo/Transform.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/FileManager.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 
 #define LOCTEXT_NAMESPACE "SlateIconReference"
 
 using FBrushResourcesMap = TMap<FName, FSlateBrush*>;
-UE_DEFINE_PRIVATE_MEMBER_PTR(FBrushResourcesMap, GBrushResources, FSlateStyleSet, BrushResources);
-// using FDynamicBrushResourceMap =  TMap< FName, TWeakPtr< FSlateDynamicImageBrush > >;
-// UE_DEFINE_PRIVATE_MEMBER_PTR(FDynamicBrushResourceMap, GDynamicBrushResources, FSlateStyleSet, DynamicBrushes);
-UE_DEFINE_PRIVATE_MEMBER_PTR(FSlateBrush*, GDefaultBrush, FSlateStyleSet, DefaultBrush);
+
+namespace Switches
+{
+	// sort and fill rescanned style sets on worker threads
+	constexpr bool bParallelBuild = true;
+	// assemble catalog on thread pool and publish it from core ticker
+	constexpr bool bAsyncBuild = true;
+	// reuse catalog saved by previous session when registry did not change
+	constexpr bool bUseDiskCache = true;
+	// record style sets only and enumerate, sort and index their brushes on game thread when first requested,
+	// otherwise brushes are copied by the snapshot and sorted and indexed by the build
+	constexpr bool bLazyMaterialization = true;
+	// recognize dynamic image brushes of known style sets on lookup, they are never cataloged or listed for picking
+	// as icon references resolve through the style set and cannot reach them at runtime
+	constexpr bool bWithDynamicBrushes = true;
+}
+
+static TAutoConsoleVariable<bool> CVarParallelCatalogBuild(
+	TEXT("SlateIconReference.ParallelCatalogBuild"),
+	Switches::bParallelBuild,
+	TEXT("If enabled, rescanned style sets of the editor icon catalog are sorted and filled on worker threads.\n")
+	TEXT("Timings of the last build are printed by SlateIconReference.DumpCatalogMemory."));
+
+static TAutoConsoleVariable<bool> CVarLazyIconCatalog(
+	TEXT("SlateIconReference.LazyCatalog"),
+	Switches::bLazyMaterialization,
+	TEXT("If enabled, catalog builds record style sets only and their icons are listed when a style set is first used.\n")
+	TEXT("Otherwise every style set is listed by the build. Applies to the next build."));
+
+namespace SlateIconCatalogCache
+{
+	// layout, bump version whenever it or the kind of cataloged brushes changes and only here:
+	//   header: magic, version, fingerprint, style set count, icon count
+	//   per style set: name, parent name, brush count, brush hash, icon count, materialized
+	//   icon names, flags and sort keys in style set order
+	//   resource name table followed by brush info of each icon referencing it
+	constexpr uint32 FileMagic = 0x53494543; // SIEC
+	constexpr uint32 FileVersion = 7;
+	// seconds without catalog changes before it is written, bursts of rescans share one write
+	constexpr float WriteDelay = 10.0f;
+}
+
+namespace SlateIconChangeDetection
+{
+	// brushes hashed per change poll, replaced brushes in large catalogs are found over several polls
+	constexpr int32 HashBudget = 4096;
+}
+
+namespace SlateIconInterning
+{
+	// unknown descriptors kept alive so repeated lookups of missing names do not allocate
+	constexpr int32 MaxUnknownDescriptors = 256;
+}
+
+namespace SlateIconCollation
+{
+	constexpr int32 MaxInheritanceDepth = 32;
+
+	static TCHAR Fold(TCHAR Char)
+	{
+		return FChar::ToLower(Char);
+	}
+
+	// leading folded characters packed so that integer order agrees with Compare
+	static uint64 MakeSortKey(FName Name)
+	{
+		TStringBuilder<128> Builder;
+		Name.AppendString(Builder);
+
+		const TCHAR* Str = Builder.ToString();
+		uint64 Key = 0;
+		for (int32 Index = 0; Index < 4; ++Index)
+		{
+			const uint32 Char = *Str ? static_cast<uint32>(Fold(*Str++)) : 0;
+			Key = (Key << 16) | FMath::Min<uint32>(Char, 0xFFFF);
+		}
+		return Key;
+	}
+
+	static int32 Compare(FName A, FName B)
+	{
+		TStringBuilder<128> BuilderA, BuilderB;
+		A.AppendString(BuilderA);
+		B.AppendString(BuilderB);
+
+		const TCHAR* StrA = BuilderA.ToString();
+		const TCHAR* StrB = BuilderB.ToString();
+		for (;; ++StrA, ++StrB)
+		{
+			const TCHAR CharA = Fold(*StrA), CharB = Fold(*StrB);
+			if (CharA != CharB || !CharA)
+			{
+				return static_cast<int32>(CharA) - static_cast<int32>(CharB);
+			}
+		}
+	}
+
+	static bool Less(uint64 KeyA, FName A, uint64 KeyB, FName B)
+	{
+		return KeyA != KeyB ? KeyA < KeyB : Compare(A, B) < 0;
+	}
+}
+
+struct FNamedBrush
+{
+	FName Name;
+	uint64 SortKey = 0;
+	uint8 Flags = ESlateIconFlags::None;
+	FSlateIconBrushInfo Info;
+
+	FNamedBrush(FName InName, uint8 InFlags, const FSlateIconBrushInfo& InInfo) : Name(InName), Flags(InFlags), Info(InInfo) { }
+};
+
+static void SortNamedBrushes(TArray<FNamedBrush>& Brushes)
+{
+	for (FNamedBrush& Brush : Brushes)
+	{
+		Brush.SortKey = SlateIconCollation::MakeSortKey(Brush.Name);
+	}
+
+	Algo::Sort(Brushes, [](const FNamedBrush& A, const FNamedBrush& B)
+	{
+		return SlateIconCollation::Less(A.SortKey, A.Name, B.SortKey, B.Name);
+	});
+}
+
+static uint8 GetBrushFlags(const FSlateBrush& Brush)
+{
+	uint8 Flags = ESlateIconFlags::None;
+	if (!Brush.GetResourceName().IsNone())
+		Flags |= ESlateIconFlags::HasResource;
+	if (Brush.DrawAs == ESlateBrushDrawType::NoDrawType)
+		Flags |= ESlateIconFlags::NoDrawType;
+	return Flags;
+}
+
+static FSlateIconBrushInfo GetBrushInfo(const FSlateBrush& Brush)
+{
+	const FVector2D Size = Brush.ImageSize;
+
+	FSlateIconBrushInfo Info;
+	Info.ResourceName = Brush.GetResourceName();
+	Info.ImageWidth = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(Size.X), 0, (int32)MAX_uint16));
+	Info.ImageHeight = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(Size.Y), 0, (int32)MAX_uint16));
+	Info.DrawType = static_cast<uint8>(Brush.GetDrawType());
+	Info.ImageType = static_cast<uint8>(Brush.GetImageType());
+	Info.Tiling = static_cast<uint8>(Brush.Tiling.GetValue());
+	return Info;
+}
+
+static void GatherNamedBrushes(const FSlateStyleSet& StyleSet, const FSlateIconNameFilter& Filter, TArray<FNamedBrush>& OutBrushes)
+{
+	const FBrushResourcesMap& BrushResourcesMap = FSlateStyleSetAccess::GetBrushResources(StyleSet);
+
+	OutBrushes.Reserve(BrushResourcesMap.Num());
+	for (const auto& KeyToBrush : BrushResourcesMap)
+	{
+		if (!KeyToBrush.Key.IsNone() && KeyToBrush.Value && Filter.PassesFilter(KeyToBrush.Key))
+		{
+			OutBrushes.Emplace(KeyToBrush.Key, GetBrushFlags(*KeyToBrush.Value), GetBrushInfo(*KeyToBrush.Value));
+		}
+	}
+}
+
+static bool HasDynamicBrush(const ISlateStyle* Style, FName Name)
+{
+	// checked without pinning, brush may still expire before anyone asks for it
+	const TWeakPtr<FSlateDynamicImageBrush>* Found = Style ? FSlateStyleSetAccess::GetDynamicBrushes(*static_cast<const FSlateStyleSet*>(Style)).Find(Name) : nullptr;
+	return Found && Found->IsValid();
+}
+
+static TSharedPtr<FSlateDynamicImageBrush> FindDynamicBrush(const ISlateStyle* Style, FName Name)
+{
+	if (!Style)
+	{
+		return nullptr;
+	}
+
+	// caller decides how long to keep it, style set itself only holds weak references
+	const TWeakPtr<FSlateDynamicImageBrush>* Found = FSlateStyleSetAccess::GetDynamicBrushes(*static_cast<const FSlateStyleSet*>(Style)).Find(Name);
+	return Found ? Found->Pin() : nullptr;
+}
+
+// name indices differ between sessions, strings do not
+static uint32 HashNameString(FName Name)
+{
+	TStringBuilder<128> Builder;
+	Name.AppendString(Builder);
+	return FCrc::StrCrc32(Builder.ToString());
+}
+
+// order independent so rehashing the map does not count as a change, covers every property the catalog captures
+// so a brush replaced within the session or between sessions changes the hash
+static uint32 ComputeBrushHash(const FBrushResourcesMap& BrushResourcesMap)
+{
+	uint32 Hash = 0;
+	for (const auto& KeyToBrush : BrushResourcesMap)
+	{
+		uint32 BrushHash = HashNameString(KeyToBrush.Key);
+		if (KeyToBrush.Value)
+		{
+			const FSlateIconBrushInfo Info = GetBrushInfo(*KeyToBrush.Value);
+			BrushHash = HashCombine(BrushHash, HashNameString(Info.ResourceName));
+			BrushHash = HashCombine(BrushHash, (static_cast<uint32>(Info.ImageWidth) << 16) | Info.ImageHeight);
+			BrushHash = HashCombine(BrushHash, (static_cast<uint32>(Info.DrawType) << 16) | (static_cast<uint32>(Info.ImageType) << 8) | Info.Tiling);
+		}
+		Hash += BrushHash;
+	}
+	// zero is reserved for not materialized
+	return Hash ? Hash : 1;
+}
+
+static void LinkIconOwner(TMap<FName, FSlateIconId>& OwnerIndex, TArray<FSlateIconId>& NextOwner, FName IconName, FSlateIconId Id)
+{
+	if (FSlateIconId* Head = OwnerIndex.Find(IconName))
+	{
+		NextOwner[Id] = *Head;
+		*Head = Id;
+	}
+	else
+	{
+		OwnerIndex.Add(IconName, Id);
+	}
+}
+
+static FAutoConsoleCommandWithOutputDevice GDumpIconCatalogMemory(
+	TEXT("SlateIconReference.DumpCatalogMemory"),
+	TEXT("Print memory used by the editor icon catalog"),
+	FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Ar)
+	{
+		FSlateIconRefDataHelper::GetDataSource().DumpMemoryStats(Ar);
+	})
+);
+
+static TSharedPtr<FSlateIconRefDataHelper> GDataSource;
+FSlateIconRefDataHelper& FSlateIconRefDataHelper::GetDataSource()
+{
+	if (!GDataSource)
+	{
+		GDataSource = MakeShared<FSlateIconRefDataHelper>();
+	}
+	return *GDataSource;
+}
+
+FSlateIconRefDataHelper::~FSlateIconRefDataHelper()
+{
+	CancelBuild();
+}
+
+void FSlateIconRefDataHelper::SetupStyleData()
+{
+	if (bInitialized && !bRescanPending)
+	{
+		return;
+	}
+
+	if (IsBuildInProgress())
+	{
+		// queued, another pass follows once current build is published
+		bRescanPending = true;
+		return;
+	}
+
+	UE_LOG(LogSlateIcon, Log, TEXT("FSlateIconDataSource::SetupStyleData"));
+
+	if (!EmptyStyleSet.IsValid())
+	{
+		EmptyStyleSet = MakeShared<FSlateStyleSetDescriptor>();
+		EmptyStyleSet->DisplayTextOverride = LOCTEXT("EmptyStyleSetName", "None");
+	}
+
+	if (!AutoStyleSet.IsValid())
+	{
+		AutoStyleSet = MakeShared<FSlateStyleSetDescriptor>();
+		AutoStyleSet->Name = FStyleHelper::GetAppStyleSetName();
+		AutoStyleSet->DisplayTextOverride = LOCTEXT("ApplicationStyleSetName", "Application");
+	}
+
+	if (!EmptyImage.IsValid())
+	{
+		EmptyImage = MakeShared<FSlateIconDescriptor>();
+	}
+	
+	if (!bFiltersCompiled)
+	{
+		CompileFilters();
+	}
+
+	const bool bColdStart = !bInitialized;
+	if (bColdStart)
+	{
+		ClearStyleData();
+	}
+
+	bInitialized = true;
+	bRescanPending = false;
+
+	const bool bReadDiskCache = bColdStart && !bSkipDiskCache;
+	bSkipDiskCache = false;
+
+	CacheFingerprint = Switches::bUseDiskCache ? ComputeRegistryFingerprint() : 0;
+	if (bReadDiskCache && Switches::bUseDiskCache && LoadCache(GetCacheFilePath(), CacheFingerprint))
+	{
+		UE_LOG(LogSlateIcon, Log, TEXT("Loaded %d style sets, %d icons from %s"), KnownStyleSets.Num(), IconNames.Num(), *GetCacheFilePath());
+
+		TArray<FName> LoadedStyleSets;
+		Algo::Transform(KnownStyleSets, LoadedStyleSets, [](const TSharedPtr<FSlateStyleSetDescriptor>& Descriptor) { return Descriptor->Name; });
+		NotifyCatalogChanged(LoadedStyleSets);
+
+		// cache written by a lazy session may leave sets empty, an eager build fills only those
+		const bool bFullyMaterialized = !KnownStyleSets.ContainsByPredicate([](const TSharedPtr<FSlateStyleSetDescriptor>& Descriptor) { return !Descriptor->bMaterialized; });
+		if (CVarLazyIconCatalog.GetValueOnGameThread() || bFullyMaterialized)
+		{
+			return;
+		}
+	}
+
+	TUniquePtr<FStyleDataBuild> Build = SnapshotStyleData();
+	if (!Build.IsValid())
+	{
+		return;
+	}
+
+	if (!Switches::bAsyncBuild)
+	{
+		BuildStyleData(*Build);
+		PublishStyleData(*Build);
+		return;
+	}
+
+	// widgets keep reading the published catalog until the build is swapped in by the ticker,
+	// build is owned here and outlives the task as it is only released after waiting for it
+	FStyleDataBuild* BuildData = Build.Get();
+	PendingBuild = MoveTemp(Build);
+	PendingBuild->Future = Async(EAsyncExecution::ThreadPool, [BuildData]()
+	{
+		BuildStyleData(*BuildData);
+	});
 
 #if !UE_VERSION_OLDER_THAN(5,0,0)
-UE_DEFINE_PRIVATE_MEMBER_PTR(FName, GParentStyleName, FSlateStyleSet, ParentStyleName);
+	BuildTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FSlateIconRefDataHelper::HandleBuildTick));
+#else
+	BuildTickHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FSlateIconRefDataHelper::HandleBuildTick));
 #endif
+}
+
+void FSlateIconRefDataHelper::MaterializeStyleSet(FSlateStyleSetDescriptor& Descriptor)
+{
+	if (Descriptor.bMaterialized || Descriptor.Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	Descriptor.bMaterialized = true;
+
+	const ISlateStyle* Style = Descriptor.GetStyleSet();
+	if (!Style)
+	{
+		return;
+	}
+
+	const FBrushResourcesMap& BrushResourcesMap = FSlateStyleSetAccess::GetBrushResources(*static_cast<const FSlateStyleSet*>(Style));
+
+	TArray<FNamedBrush> Brushes;
+	GatherNamedBrushes(*static_cast<const FSlateStyleSet*>(Style), IconFilter, Brushes);
+	SortNamedBrushes(Brushes);
+
+	// appended ranges are laid out in style set order again on the next update
+	Descriptor.FirstIcon = IconNames.Num();
+	Descriptor.NumIcons = Brushes.Num();
+	Descriptor.NumBrushes = BrushResourcesMap.Num();
+	Descriptor.BrushHash = ComputeBrushHash(BrushResourcesMap);
+
+	IconNames.Reserve(IconNames.Num() + Brushes.Num());
+	IconStyleSets.Reserve(IconStyleSets.Num() + Brushes.Num());
+	IconFlags.Reserve(IconFlags.Num() + Brushes.Num());
+	IconSortKeys.Reserve(IconSortKeys.Num() + Brushes.Num());
+	IconBrushInfos.Reserve(IconBrushInfos.Num() + Brushes.Num());
+
+	for (const FNamedBrush& NamedBrush : Brushes)
+	{
+		const FSlateIconId Id = IconNames.Add(NamedBrush.Name);
+		IconStyleSets.Add(static_cast<uint16>(Descriptor.Index));
+		IconFlags.Add(NamedBrush.Flags);
+		IconSortKeys.Add(NamedBrush.SortKey);
+		IconBrushInfos.Add(NamedBrush.Info);
+		NextIconOwner.Add(InvalidSlateIconId);
+		LinkIconOwner(IconOwnerIndex, NextIconOwner, NamedBrush.Name, Id);
+	}
+
+	UE_LOG(LogSlateIcon, Verbose, TEXT("Materialized style: %s, %d icons"), *Descriptor.Name.ToString(), Descriptor.NumIcons);
+	MarkCacheDirty();
+}
 
-struct FDescriptorFinder
+bool FSlateIconRefDataHelper::DetectChangedStyleSets()
 {
-	const FName Key;
-	FDescriptorFinder(const FName& Key) : Key(Key) { }
+	if (!bInitialized || IsBuildInProgress())
+	{
+		return false;
+	}
+
+	bool bChanged = false;
+	int32 NumKnownFound = 0;
+
+	// registered, removed and resized sets are caught by counts alone
+	FSlateStyleRegistry::IterateAllStyles([this, &bChanged, &NumKnownFound](const ISlateStyle& Style)
+	{
+		FName StyleName = Style.GetStyleSetName();
+		if (StyleName.IsNone() || IsIgnoredStyleSet(StyleName))
+			return true;
+
+		const int32* Found = KnownStyleSetIndices.Find(StyleName);
+		if (!Found)
+		{
+			UE_LOG(LogSlateIcon, Verbose, TEXT("Detected new style: %s"), *StyleName.ToString());
+			bChanged = true;
+			return false;
+		}
 
-	bool operator== (const FSlateStyleSetDescriptor& A) const { return A.Name == Key; }
-	bool operator== (const TSharedPtr<FSlateStyleSetDescriptor>& A) const { return A->Name == Key; }
-	bool operator== (const FSlateIconDescriptor& A) const { return A.Name == Key; }
-	bool operator== (const TSharedPtr<FSlateIconDescriptor>& A) const { return A->Name == Key; }
+		++NumKnownFound;
+
+		const FBrushResourcesMap& BrushResourcesMap = FSlateStyleSetAccess::GetBrushResources(static_cast<const FSlateStyleSet&>(Style));
+		if (KnownStyleSets[*Found]->NumBrushes != BrushResourcesMap.Num())
+		{
+			UE_LOG(LogSlateIcon, Verbose, TEXT("Detected modified style: %s"), *StyleName.ToString());
+			bChanged = true;
+			return false;
+		}
+
+		return true;
+	});
+
+	if (bChanged || NumKnownFound != KnownStyleSets.Num())
+	{
+		return true;
+	}
+
+	// replaced brushes need a hash, spread over polls and limited to sets with listed icons
+	int32 Budget = SlateIconChangeDetection::HashBudget;
+	for (int32 Visited = 0; Visited < KnownStyleSets.Num() && Budget > 0; ++Visited)
+	{
+		NextHashedStyleSet = (NextHashedStyleSet + 1) % KnownStyleSets.Num();
+
+		FSlateStyleSetDescriptor& Descriptor = *KnownStyleSets[NextHashedStyleSet];
+		const ISlateStyle* Style = Descriptor.bMaterialized ? Descriptor.GetStyleSet() : nullptr;
+		if (!Style)
+		{
+			continue;
+		}
+
+		const FBrushResourcesMap& BrushResourcesMap = FSlateStyleSetAccess::GetBrushResources(*static_cast<const FSlateStyleSet*>(Style));
+		Budget -= BrushResourcesMap.Num();
+
+		if (Descriptor.BrushHash != ComputeBrushHash(BrushResourcesMap))
+		{
+			UE_LOG(LogSlateIcon, Verbose, TEXT("Detected modified style: %s"), *Descriptor.Name.ToString());
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FSlateIconRefDataHelper::CompileFilters()
+{
+	auto ReadPatterns = [](const TCHAR* Key)
+	{
+		TArray<FString> Strings;
+		GConfig->GetArray(TEXT("SlateIconReference"), Key, Strings, GEditorIni);
+		return Strings;
+	};
+
+	StyleSetFilter.Compile(ReadPatterns(TEXT("IncludedStyleSets")), ReadPatterns(TEXT("IgnoredStyleSets")));
+	IconFilter.Compile(ReadPatterns(TEXT("IncludedIcons")), ReadPatterns(TEXT("IgnoredIcons")));
+	bFiltersCompiled = true;
+}
+
+bool FSlateIconRefDataHelper::IsIgnoredStyleSet(FName StyleSetName) const
+{
+	return !StyleSetFilter.PassesFilter(StyleSetName);
+}
+
+bool FSlateIconRefDataHelper::IsIgnoredIcon(FName IconName) const
+{
+	return !IconFilter.PassesFilter(IconName);
+}
+
+struct FSlateIconRefDataHelper::FStyleDataBuild
+{
+	// plain copy of style set state, live descriptors are neither touched nor referenced while building
+	struct FStyleSetEntry
+	{
+		FName Name;
+		// index in Descriptors
+		int32 DescriptorIndex = INDEX_NONE;
+		// descriptor state applied on publish
+		FName ParentStyleName;
+		int32 NumBrushes = 0;
+		uint32 BrushHash = 0;
+		bool bMaterialized = false;
+		// previous range start when icons are reused from current catalog
+		int32 PreviousFirstIcon = INDEX_NONE;
+		// brushes snapshot of rescanned style set
+		TArray<FNamedBrush> Brushes;
+		int32 FirstIcon = 0;
+		int32 NumIcons = 0;
+		// brushes were snapshotted or the set was dropped to be materialized again
+		bool bRescanned = false;
+	};
+
+	TArray<FStyleSetEntry> Entries;
+	// descriptor instances entries are published to, reference counted on game thread only so the worker never sees them
+	TArray<TSharedPtr<FSlateStyleSetDescriptor>> Descriptors;
+	// added, rescanned and removed style sets reported with the change notification
+	TArray<FName> ChangedStyleSets;
+	int32 NumRescanned = 0;
+	int32 NumRemoved = 0;
+	bool bParallel = false;
+	// rescanned style sets are left for materialization on first use
+	bool bLazy = false;
+	double StartTime = 0.0;
+	double SnapshotSeconds = 0.0;
+	double BuildSeconds = 0.0;
+
+	// copy of current catalog for reused ranges, game thread may append to it while building
+	TArray<FName> PreviousIconNames;
+	TArray<uint8> PreviousIconFlags;
+	TArray<uint64> PreviousIconSortKeys;
+	TArray<FSlateIconBrushInfo> PreviousIconBrushInfos;
+
+	// assembled catalog
+	TArray<FName> IconNames;
+	TArray<uint16> IconStyleSets;
+	TArray<uint8> IconFlags;
+	TArray<uint64> IconSortKeys;
+	TArray<FSlateIconBrushInfo> IconBrushInfos;
+	TMap<FName, FSlateIconId> IconOwnerIndex;
+	TArray<FSlateIconId> NextIconOwner;
+
+	TFuture<void> Future;
 };
 
-struct FDescriptorSorters
-{
-	bool operator() (const TSharedPtr<FSlateStyleSetDescriptor>& A, const TSharedPtr<FSlateStyleSetDescriptor>& B) const
+TUniquePtr<FSlateIconRefDataHelper::FStyleDataBuild> FSlateIconRefDataHelper::SnapshotStyleData()
+{
+	check(IsInGameThread());
+
+	TUniquePtr<FStyleDataBuild> Build = MakeUnique<FStyleDataBuild>();
+	Build->StartTime = FPlatformTime::Seconds();
+	Build->bLazy = CVarLazyIconCatalog.GetValueOnGameThread();
+
+	const bool bLazy = Build->bLazy;
+	TArray<FStyleDataBuild::FStyleSetEntry>& Entries = Build->Entries;
+	TArray<TSharedPtr<FSlateStyleSetDescriptor>>& Descriptors = Build->Descriptors;
+	TArray<FName>& ChangedStyleSets = Build->ChangedStyleSets;
+	TBitArray<> KnownFound(false, KnownStyleSets.Num());
+	int32 NumRescanned = 0;
+
+	// registry and brush maps are only touched here, everything past the snapshot works on copies
+	FSlateStyleRegistry::IterateAllStyles([this, bLazy, &Entries, &Descriptors, &ChangedStyleSets, &KnownFound, &NumRescanned](const ISlateStyle& Style)
+	{
+		FName StyleName = Style.GetStyleSetName();
+		if (StyleName.IsNone() || IsIgnoredStyleSet(StyleName))
+			return true;
+
+		const FSlateStyleSet& SlateStyleSet = static_cast<const FSlateStyleSet&>(Style);
+		const FBrushResourcesMap& BrushResourcesMap = FSlateStyleSetAccess::GetBrushResources(SlateStyleSet);
+
+		const FName ParentStyleName = FSlateStyleSetAccess::GetParentStyleName(SlateStyleSet);
+
+		FStyleDataBuild::FStyleSetEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Name = StyleName;
+		Entry.ParentStyleName = ParentStyleName;
+		Entry.NumBrushes = BrushResourcesMap.Num();
+
+		// keep descriptor instance so widgets holding it stay valid
+		if (const int32* Found = KnownStyleSetIndices.Find(StyleName))
+		{
+			const FSlateStyleSetDescriptor& Descriptor = *KnownStyleSets[*Found];
+			Entry.DescriptorIndex = Descriptors.Add(KnownStyleSets[*Found]);
+			KnownFound[*Found] = true;
+			// sets not materialized yet have no hash, brush count and parent are all there is to compare
+			Entry.BrushHash = Descriptor.bMaterialized ? ComputeBrushHash(BrushResourcesMap) : 0;
+			const bool bSameBrushes = Descriptor.NumBrushes == Entry.NumBrushes && Descriptor.BrushHash == Entry.BrushHash;
+			// sets left empty by a lazy session are filled by an eager build rather than on first use
+			const bool bNeedsBrushes = !bLazy && !Descriptor.bMaterialized;
+			if (bSameBrushes && !bNeedsBrushes && Descriptor.ParentStyleName == ParentStyleName)
+			{
+				Entry.bMaterialized = Descriptor.bMaterialized;
+				Entry.PreviousFirstIcon = Descriptor.FirstIcon;
+				Entry.NumIcons = Descriptor.NumIcons;
+				return true;
+			}
+		}
+		else
+		{
+			TSharedPtr<FSlateStyleSetDescriptor> Descriptor = MakeShared<FSlateStyleSetDescriptor>();
+			Descriptor->Name = StyleName;
+			Entry.DescriptorIndex = Descriptors.Add(Descriptor);
+		}
+
+		UE_LOG(LogSlateIcon, Verbose, TEXT("Found style: %s"), *StyleName.ToString());
+		ChangedStyleSets.Add(StyleName);
+		++NumRescanned;
+
+		Entry.bRescanned = true;
+		Entry.bMaterialized = !bLazy;
+		if (Entry.bMaterialized)
+		{
+			Entry.BrushHash = ComputeBrushHash(BrushResourcesMap);
+			GatherNamedBrushes(SlateStyleSet, IconFilter, Entry.Brushes);
+			Entry.NumIcons = Entry.Brushes.Num();
+		}
+		else
+		{
+			Entry.BrushHash = 0;
+		}
+
+		return true;
+	});
+
+	for (int32 Index = 0; Index < KnownStyleSets.Num(); ++Index)
+	{
+		if (!KnownFound[Index])
+		{
+			ChangedStyleSets.Add(KnownStyleSets[Index]->Name);
+		}
+	}
+
+	Build->NumRescanned = NumRescanned;
+	Build->NumRemoved = ChangedStyleSets.Num() - NumRescanned;
+
+	if (NumRescanned == 0 && Build->NumRemoved == 0)
+	{
+		return nullptr;
+	}
+
+	Build->PreviousIconNames = IconNames;
+	Build->PreviousIconFlags = IconFlags;
+	Build->PreviousIconSortKeys = IconSortKeys;
+	Build->PreviousIconBrushInfos = IconBrushInfos;
+	Build->bParallel = CVarParallelCatalogBuild.GetValueOnGameThread();
+	Build->SnapshotSeconds = FPlatformTime::Seconds() - Build->StartTime;
+	return Build;
+}
+
+void FSlateIconRefDataHelper::BuildStyleData(FStyleDataBuild& Build)
+{
+	const double BuildStartTime = FPlatformTime::Seconds();
+	TArray<FStyleDataBuild::FStyleSetEntry>& Entries = Build.Entries;
+
+	Algo::Sort(Entries, [](const FStyleDataBuild::FStyleSetEntry& A, const FStyleDataBuild::FStyleSetEntry& B)
+	{
+		return SlateIconCollation::Compare(A.Name, B.Name) < 0;
+	});
+	check(Entries.Num() <= MAX_uint16);
+
+	int32 TotalIcons = 0;
+	for (FStyleDataBuild::FStyleSetEntry& Entry : Entries)
+	{
+		Entry.FirstIcon = TotalIcons;
+		TotalIcons += Entry.NumIcons;
+	}
+
+	Build.IconNames.SetNumUninitialized(TotalIcons);
+	Build.IconStyleSets.SetNumUninitialized(TotalIcons);
+	Build.IconFlags.SetNumUninitialized(TotalIcons);
+	Build.IconSortKeys.SetNumUninitialized(TotalIcons);
+	Build.IconBrushInfos.SetNum(TotalIcons);
+
+	// sets own disjoint ranges of the new arrays so they can be filled independently
+	ParallelFor(Entries.Num(), [&Build, &Entries](int32 Index)
+	{
+		FStyleDataBuild::FStyleSetEntry& Entry = Entries[Index];
+
+		if (Entry.PreviousFirstIcon != INDEX_NONE)
+		{
+			FMemory::Memcpy(Build.IconNames.GetData() + Entry.FirstIcon, Build.PreviousIconNames.GetData() + Entry.PreviousFirstIcon, Entry.NumIcons * sizeof(FName));
+			FMemory::Memcpy(Build.IconFlags.GetData() + Entry.FirstIcon, Build.PreviousIconFlags.GetData() + Entry.PreviousFirstIcon, Entry.NumIcons * sizeof(uint8));
+			FMemory::Memcpy(Build.IconSortKeys.GetData() + Entry.FirstIcon, Build.PreviousIconSortKeys.GetData() + Entry.PreviousFirstIcon, Entry.NumIcons * sizeof(uint64));
+			for (int32 Offset = 0; Offset < Entry.NumIcons; ++Offset)
+			{
+				Build.IconBrushInfos[Entry.FirstIcon + Offset] = Build.PreviousIconBrushInfos[Entry.PreviousFirstIcon + Offset];
+			}
+		}
+		else
+		{
+			SortNamedBrushes(Entry.Brushes);
+
+			for (int32 Offset = 0; Offset < Entry.NumIcons; ++Offset)
+			{
+				const FNamedBrush& NamedBrush = Entry.Brushes[Offset];
+				Build.IconNames[Entry.FirstIcon + Offset] = NamedBrush.Name;
+				Build.IconFlags[Entry.FirstIcon + Offset] = NamedBrush.Flags;
+				Build.IconSortKeys[Entry.FirstIcon + Offset] = NamedBrush.SortKey;
+				Build.IconBrushInfos[Entry.FirstIcon + Offset] = NamedBrush.Info;
+			}
+		}
+
+		for (int32 Offset = 0; Offset < Entry.NumIcons; ++Offset)
+		{
+			Build.IconStyleSets[Entry.FirstIcon + Offset] = static_cast<uint16>(Index);
+		}
+	}, !Build.bParallel);
+
+	Build.IconOwnerIndex.Reserve(TotalIcons);
+	Build.NextIconOwner.Init(InvalidSlateIconId, TotalIcons);
+	for (FSlateIconId Id = 0; Id < (FSlateIconId)TotalIcons; ++Id)
+	{
+		LinkIconOwner(Build.IconOwnerIndex, Build.NextIconOwner, Build.IconNames[Id], Id);
+	}
+
+	Build.PreviousIconNames.Empty();
+	Build.PreviousIconFlags.Empty();
+	Build.PreviousIconSortKeys.Empty();
+	Build.PreviousIconBrushInfos.Empty();
+
+	Build.BuildSeconds = FPlatformTime::Seconds() - BuildStartTime;
+}
+
+void FSlateIconRefDataHelper::PublishStyleData(FStyleDataBuild& Build)
+{
+	check(IsInGameThread());
+
+	const double PublishStartTime = FPlatformTime::Seconds();
+	const TArray<FStyleDataBuild::FStyleSetEntry>& Entries = Build.Entries;
+
+	// old id to new id for every reused range, views over rescanned sets are detached
+	TMap<FSlateIconId, TWeakPtr<FSlateIconDescriptor>> NewIconViews;
+	NewIconViews.Reserve(IconViews.Num());
+
+	KnownStyleSets.Reset();
+	KnownStyleSetIndices.Reset();
+
+	for (int32 Index = 0; Index < Entries.Num(); ++Index)
+	{
+		const FStyleDataBuild::FStyleSetEntry& Entry = Entries[Index];
+		const TSharedPtr<FSlateStyleSetDescriptor>& DescriptorPtr = Build.Descriptors[Entry.DescriptorIndex];
+		FSlateStyleSetDescriptor& Descriptor = *DescriptorPtr;
+
+		// set materialized on first use while building appended a range the build does not have, it is carried over
+		const bool bCarryOver = !Entry.bMaterialized && !Entry.bRescanned && Descriptor.bMaterialized;
+		const int32 PreviousFirstIcon = bCarryOver ? Descriptor.FirstIcon : Entry.PreviousFirstIcon;
+		const int32 FirstIcon = bCarryOver ? Build.IconNames.Num() : Entry.FirstIcon;
+		const int32 NumIcons = bCarryOver ? Descriptor.NumIcons : Entry.NumIcons;
+
+		if (bCarryOver)
+		{
+			for (int32 Offset = 0; Offset < NumIcons; ++Offset)
+			{
+				const FSlateIconId OldId = PreviousFirstIcon + Offset;
+				const FSlateIconId NewId = Build.IconNames.Add(IconNames[OldId]);
+				Build.IconStyleSets.Add(static_cast<uint16>(Index));
+				Build.IconFlags.Add(IconFlags[OldId]);
+				Build.IconSortKeys.Add(IconSortKeys[OldId]);
+				Build.IconBrushInfos.Add(IconBrushInfos[OldId]);
+				Build.NextIconOwner.Add(InvalidSlateIconId);
+				LinkIconOwner(Build.IconOwnerIndex, Build.NextIconOwner, IconNames[OldId], NewId);
+			}
+		}
+		else
+		{
+			Descriptor.NumBrushes = Entry.NumBrushes;
+			Descriptor.BrushHash = Entry.BrushHash;
+			Descriptor.bMaterialized = Entry.bMaterialized;
+		}
+
+		if (PreviousFirstIcon != INDEX_NONE && IconViews.Num())
+		{
+			for (int32 Offset = 0; Offset < NumIcons; ++Offset)
+			{
+				const FSlateIconId OldId = PreviousFirstIcon + Offset;
+				if (TWeakPtr<FSlateIconDescriptor>* View = IconViews.Find(OldId))
+				{
+					if (TSharedPtr<FSlateIconDescriptor> Pinned = View->Pin())
+					{
+						Pinned->Id = FirstIcon + Offset;
+						NewIconViews.Add(Pinned->Id, Pinned);
+					}
+					IconViews.Remove(OldId);
+				}
+			}
+		}
+
+		Descriptor.ParentStyleName = Entry.ParentStyleName;
+		Descriptor.Index = Index;
+		Descriptor.FirstIcon = FirstIcon;
+		Descriptor.NumIcons = NumIcons;
+		Descriptor.bInheritedIconsValid = false;
+		Descriptor.InheritedIcons.Empty();
+
+		KnownStyleSets.Add(DescriptorPtr);
+		KnownStyleSetIndices.Add(Descriptor.Name, Index);
+	}
+
+	for (const auto& IdToView : IconViews)
+	{
+		if (TSharedPtr<FSlateIconDescriptor> Pinned = IdToView.Value.Pin())
+		{
+			Pinned->Id = InvalidSlateIconId;
+		}
+	}
+
+	IconNames = MoveTemp(Build.IconNames);
+	IconStyleSets = MoveTemp(Build.IconStyleSets);
+	IconFlags = MoveTemp(Build.IconFlags);
+	IconSortKeys = MoveTemp(Build.IconSortKeys);
+	IconBrushInfos = MoveTemp(Build.IconBrushInfos);
+	IconOwnerIndex = MoveTemp(Build.IconOwnerIndex);
+	NextIconOwner = MoveTemp(Build.NextIconOwner);
+	IconViews = MoveTemp(NewIconViews);
+	ResolveStyleSetParents();
+	// names missing before may be registered now
+	UnknownStyleSets.Reset();
+	UnknownIcons.Reset();
+	NextIconViewPrune = FMath::Max(1024, IconViews.Num() * 2);
+
+	LastBuildStats.NumStyleSets = Entries.Num();
+	LastBuildStats.NumRescanned = Build.NumRescanned;
+	LastBuildStats.NumIcons = IconNames.Num();
+	LastBuildStats.bParallel = Build.bParallel;
+	LastBuildStats.SnapshotSeconds = Build.SnapshotSeconds;
+	LastBuildStats.BuildSeconds = Build.BuildSeconds;
+	LastBuildStats.PublishSeconds = FPlatformTime::Seconds() - PublishStartTime;
+
+	UE_LOG(LogSlateIcon, Log, TEXT("Rescanned %d of %d style sets, %d removed, %d icons in %.2f ms (snapshot %.2f ms, %s build %.2f ms, publish %.2f ms)"),
+		Build.NumRescanned, Entries.Num(), Build.NumRemoved, IconNames.Num(), (FPlatformTime::Seconds() - Build.StartTime) * 1000.0,
+		LastBuildStats.SnapshotSeconds * 1000.0, Build.bParallel ? TEXT("parallel") : TEXT("serial"), LastBuildStats.BuildSeconds * 1000.0, LastBuildStats.PublishSeconds * 1000.0);
+
+	MarkCacheDirty();
+
+	NotifyCatalogChanged(Build.ChangedStyleSets);
+}
+
+void FSlateIconRefDataHelper::NotifyCatalogChanged(const TArray<FName>& ChangedStyleSets)
+{
+	if (++CatalogGeneration == 0)
+	{
+		CatalogGeneration = 1;
+	}
+
+	CatalogChangedEvent.Broadcast(ChangedStyleSets);
+}
+
+bool FSlateIconRefDataHelper::HandleBuildTick(float DeltaTime)
+{
+	if (PendingBuild.IsValid() && !PendingBuild->Future.IsReady())
+	{
+		return true;
+	}
+
+	BuildTickHandle.Reset();
+	FinishBuild();
+	return false;
+}
+
+void FSlateIconRefDataHelper::FinishBuild()
+{
+	check(IsInGameThread());
+
+	if (BuildTickHandle.IsValid())
+	{
+#if !UE_VERSION_OLDER_THAN(5,0,0)
+		FTSTicker::GetCoreTicker().RemoveTicker(BuildTickHandle);
+#else
+		FTicker::GetCoreTicker().RemoveTicker(BuildTickHandle);
+#endif
+		BuildTickHandle.Reset();
+	}
+
+	if (!PendingBuild.IsValid())
+	{
+		return;
+	}
+
+	PendingBuild->Future.Wait();
+
+	TUniquePtr<FStyleDataBuild> Build = MoveTemp(PendingBuild);
+	PublishStyleData(*Build);
+	Build.Reset();
+
+	// changes reported while building are picked up by another pass
+	if (!bInitialized || bRescanPending)
+	{
+		SetupStyleData();
+	}
+}
+
+void FSlateIconRefDataHelper::CancelBuild()
+{
+	if (BuildTickHandle.IsValid())
+	{
+#if !UE_VERSION_OLDER_THAN(5,0,0)
+		FTSTicker::GetCoreTicker().RemoveTicker(BuildTickHandle);
+#else
+		FTicker::GetCoreTicker().RemoveTicker(BuildTickHandle);
+#endif
+		BuildTickHandle.Reset();
+	}
+
+	if (PendingBuild.IsValid())
+	{
+		PendingBuild->Future.Wait();
+		PendingBuild.Reset();
+	}
+}
+
+FString FSlateIconRefDataHelper::GetCacheFilePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("SlateIconReference") / TEXT("EditorCatalog.bin");
+}
+
+uint32 FSlateIconRefDataHelper::ComputeRegistryFingerprint() const
+{
+	// name hashes must be stable between sessions so strings are hashed instead of name indices
+	TArray<uint32, TInlineAllocator<256>> StyleHashes;
+	FSlateStyleRegistry::IterateAllStyles([this, &StyleHashes](const ISlateStyle& Style)
+	{
+		FName StyleName = Style.GetStyleSetName();
+		if (StyleName.IsNone() || IsIgnoredStyleSet(StyleName))
+			return true;
+
+		const FSlateStyleSet& SlateStyleSet = static_cast<const FSlateStyleSet&>(Style);
+
+		uint32 Hash = FCrc::StrCrc32(*StyleName.ToString());
+		Hash = HashCombine(Hash, ::GetTypeHash(FSlateStyleSetAccess::GetBrushResources(SlateStyleSet).Num()));
+		Hash = HashCombine(Hash, FCrc::StrCrc32(*FSlateStyleSetAccess::GetParentStyleName(SlateStyleSet).ToString()));
+		StyleHashes.Add(Hash);
+		return true;
+	});
+
+	// registry iteration order is not stable
+	StyleHashes.Sort();
+
+	// catalog content depends on filter rules as well
+	uint32 Result = HashCombine(SlateIconCatalogCache::FileVersion, HashCombine(StyleSetFilter.GetRulesHash(), IconFilter.GetRulesHash()));
+	for (uint32 Hash : StyleHashes)
+	{
+		Result = HashCombine(Result, Hash);
+	}
+	return Result;
+}
+
+bool FSlateIconRefDataHelper::LoadCache(const FString& InFilePath, uint32 InFingerprint)
+{
+	if (!IFileManager::Get().FileExists(*InFilePath))
+	{
+		return false;
+	}
+
+	// names are stored as strings and become FNames on load, so the file is small and read in full
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *InFilePath) || Bytes.Num() == 0)
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+
+	uint32 Magic = 0, Version = 0, Fingerprint = 0;
+	int32 NumStyleSets = 0, NumIcons = 0;
+	Reader << Magic << Version << Fingerprint << NumStyleSets << NumIcons;
+	if (Reader.IsError() || Magic != SlateIconCatalogCache::FileMagic || Version != SlateIconCatalogCache::FileVersion || Fingerprint != InFingerprint)
+	{
+		return false;
+	}
+
+	if (NumStyleSets < 0 || NumStyleSets > MAX_uint16 || NumIcons < 0 || NumIcons > Bytes.Num())
+	{
+		return false;
+	}
+
+	TArray<TSharedPtr<FSlateStyleSetDescriptor>> LoadedStyleSets;
+	LoadedStyleSets.Reserve(NumStyleSets);
+
+	int32 NextIcon = 0;
+	for (int32 Index = 0; Index < NumStyleSets; ++Index)
+	{
+		FString Name, ParentName;
+		int32 NumBrushes = 0, NumSetIcons = 0;
+		uint32 BrushHash = 0;
+		bool bMaterialized = false;
+		Reader << Name << ParentName << NumBrushes << BrushHash << NumSetIcons << bMaterialized;
+		if (Reader.IsError() || NumSetIcons < 0 || NextIcon + NumSetIcons > NumIcons)
+		{
+			return false;
+		}
+
+		auto Descriptor = MakeShared<FSlateStyleSetDescriptor>();
+		Descriptor->Name = FName(*Name);
+		Descriptor->ParentStyleName = ParentName.IsEmpty() ? NAME_None : FName(*ParentName);
+		Descriptor->Index = Index;
+		Descriptor->FirstIcon = NextIcon;
+		Descriptor->NumIcons = NumSetIcons;
+		Descriptor->NumBrushes = NumBrushes;
+		Descriptor->BrushHash = BrushHash;
+		Descriptor->bMaterialized = bMaterialized;
+		LoadedStyleSets.Add(Descriptor);
+
+		NextIcon += NumSetIcons;
+	}
+
+	if (NextIcon != NumIcons)
+	{
+		return false;
+	}
+
+	TArray<FName> LoadedNames;
+	LoadedNames.Reserve(NumIcons);
+	for (int32 Index = 0; Index < NumIcons && !Reader.IsError(); ++Index)
+	{
+		FString IconName;
+		Reader << IconName;
+		LoadedNames.Add(FName(*IconName));
+	}
+
+	TArray<uint8> LoadedFlags;
+	LoadedFlags.SetNumUninitialized(NumIcons);
+	Reader.Serialize(LoadedFlags.GetData(), NumIcons);
+
+	// keys depend on name strings only so they remain valid between sessions
+	TArray<uint64> LoadedSortKeys;
+	LoadedSortKeys.SetNumUninitialized(NumIcons);
+	for (uint64& SortKey : LoadedSortKeys)
+	{
+		Reader << SortKey;
+	}
+
+	int32 NumResourceNames = 0;
+	Reader << NumResourceNames;
+	if (Reader.IsError() || NumResourceNames < 0 || NumResourceNames > NumIcons)
+	{
+		return false;
+	}
+
+	TArray<FName> ResourceNames;
+	ResourceNames.Reserve(NumResourceNames);
+	for (int32 Index = 0; Index < NumResourceNames && !Reader.IsError(); ++Index)
+	{
+		FString ResourceName;
+		Reader << ResourceName;
+		ResourceNames.Add(ResourceName.IsEmpty() ? NAME_None : FName(*ResourceName));
+	}
+
+	TArray<FSlateIconBrushInfo> LoadedBrushInfos;
+	LoadedBrushInfos.SetNum(NumIcons);
+	for (FSlateIconBrushInfo& Info : LoadedBrushInfos)
+	{
+		int32 ResourceIndex = INDEX_NONE;
+		Reader << ResourceIndex << Info.ImageWidth << Info.ImageHeight << Info.DrawType << Info.ImageType << Info.Tiling;
+		if (Reader.IsError() || !ResourceNames.IsValidIndex(ResourceIndex))
+		{
+			return false;
+		}
+		Info.ResourceName = ResourceNames[ResourceIndex];
+	}
+
+	if (Reader.IsError())
 	{
-		return A->Name.ToString() < B->Name.ToString();
+		return false;
 	}
-	
-	bool operator() (const TSharedPtr<FSlateIconDescriptor>& A, const TSharedPtr<FSlateIconDescriptor>& B) const
+
+	// fingerprint only covers brush counts, sets whose brushes were replaced since the cache was written are left
+	// empty and scanned again
+	int32 NumKept = 0;
+	for (const TSharedPtr<FSlateStyleSetDescriptor>& Descriptor : LoadedStyleSets)
 	{
-		return A->Name.ToString() < B->Name.ToString();
+		const ISlateStyle* Style = Descriptor->bMaterialized ? Descriptor->GetStyleSet() : nullptr;
+		if (Style && ComputeBrushHash(FSlateStyleSetAccess::GetBrushResources(*static_cast<const FSlateStyleSet*>(Style))) == Descriptor->BrushHash)
+		{
+			// ranges only move towards the start, compacting in place is safe
+			for (int32 Offset = 0; Offset < Descriptor->NumIcons && Descriptor->FirstIcon != NumKept; ++Offset)
+			{
+				LoadedNames[NumKept + Offset] = LoadedNames[Descriptor->FirstIcon + Offset];
+				LoadedFlags[NumKept + Offset] = LoadedFlags[Descriptor->FirstIcon + Offset];
+				LoadedSortKeys[NumKept + Offset] = LoadedSortKeys[Descriptor->FirstIcon + Offset];
+				LoadedBrushInfos[NumKept + Offset] = LoadedBrushInfos[Descriptor->FirstIcon + Offset];
+			}
+		}
+		else
+		{
+			UE_CLOG(Descriptor->bMaterialized, LogSlateIcon, Verbose, TEXT("Cached style changed: %s"), *Descriptor->Name.ToString());
+			Descriptor->bMaterialized = false;
+			Descriptor->BrushHash = 0;
+			Descriptor->NumIcons = 0;
+		}
+		Descriptor->FirstIcon = NumKept;
+		NumKept += Descriptor->NumIcons;
 	}
-};
 
-static TSharedPtr<FSlateIconRefDataHelper> GDataSource;
-FSlateIconRefDataHelper& FSlateIconRefDataHelper::GetDataSource()
-{
-	if (!GDataSource)
+	LoadedNames.SetNum(NumKept);
+	LoadedFlags.SetNum(NumKept);
+	LoadedSortKeys.SetNum(NumKept);
+	LoadedBrushInfos.SetNum(NumKept);
+
+	ClearStyleData();
+
+	KnownStyleSets = MoveTemp(LoadedStyleSets);
+	IconNames = MoveTemp(LoadedNames);
+	IconFlags = MoveTemp(LoadedFlags);
+	IconSortKeys = MoveTemp(LoadedSortKeys);
+	IconBrushInfos = MoveTemp(LoadedBrushInfos);
+
+	IconStyleSets.Reserve(NumKept);
+	KnownStyleSetIndices.Reserve(NumStyleSets);
+
+	for (const TSharedPtr<FSlateStyleSetDescriptor>& Descriptor : KnownStyleSets)
 	{
-		GDataSource = MakeShared<FSlateIconRefDataHelper>();
+		KnownStyleSetIndices.Add(Descriptor->Name, Descriptor->Index);
+
+		for (int32 Id = Descriptor->FirstIcon; Id < Descriptor->FirstIcon + Descriptor->NumIcons; ++Id)
+		{
+			IconStyleSets.Add(static_cast<uint16>(Descriptor->Index));
+		}
 	}
-	return *GDataSource;
+
+	RebuildIconLookup();
+	return true;
 }
 
-void FSlateIconRefDataHelper::SetupStyleData()
+void FSlateIconRefDataHelper::MarkCacheDirty()
 {
-	if (bInitialized)
+	if (!Switches::bUseDiskCache)
 	{
 		return;
 	}
 
-	UE_LOG(LogSlateIcon, Log, TEXT("FSlateIconDataSource::SetupStyleData"));
-	bInitialized = true;
+	bCacheDirty = true;
+	LastCacheChangeTime = FPlatformTime::Seconds();
 
-	if (!EmptyStyleSet.IsValid())
+	if (!CacheFlushTickHandle.IsValid())
 	{
-		EmptyStyleSet = MakeShared<FSlateStyleSetDescriptor>();
-		EmptyStyleSet->DisplayTextOverride = LOCTEXT("EmptyStyleSetName", "None");
+#if !UE_VERSION_OLDER_THAN(5,0,0)
+		CacheFlushTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FSlateIconRefDataHelper::HandleCacheFlushTick), SlateIconCatalogCache::WriteDelay);
+#else
+		CacheFlushTickHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FSlateIconRefDataHelper::HandleCacheFlushTick), SlateIconCatalogCache::WriteDelay);
+#endif
 	}
+}
 
-	if (!AutoStyleSet.IsValid())
+bool FSlateIconRefDataHelper::HandleCacheFlushTick(float DeltaTime)
+{
+	// wait for the catalog to settle, every change pushes the write back
+	if (IsBuildInProgress() || FPlatformTime::Seconds() - LastCacheChangeTime < SlateIconCatalogCache::WriteDelay)
 	{
-		AutoStyleSet = MakeShared<FSlateStyleSetDescriptor>();
-		AutoStyleSet->Name = FStyleHelper::GetAppStyleSetName();
-		AutoStyleSet->DisplayTextOverride = LOCTEXT("ApplicationStyleSetName", "Application");
+		return true;
 	}
 
-	if (!EmptyImage.IsValid())
+	CacheFlushTickHandle.Reset();
+	FlushCache();
+	return false;
+}
+
+void FSlateIconRefDataHelper::FlushCache()
+{
+	if (CacheFlushTickHandle.IsValid())
 	{
-		EmptyImage = MakeShared<FSlateIconDescriptor>();
-		EmptyImage->DisplayTextOverride = LOCTEXT("EmptyImageName", "None");
+#if !UE_VERSION_OLDER_THAN(5,0,0)
+		FTSTicker::GetCoreTicker().RemoveTicker(CacheFlushTickHandle);
+#else
+		FTicker::GetCoreTicker().RemoveTicker(CacheFlushTickHandle);
+#endif
+		CacheFlushTickHandle.Reset();
 	}
-	
-	if (!IgnoredStyleSets.IsSet())
+
+	if (Switches::bUseDiskCache && bCacheDirty && bInitialized)
 	{
-		TArray<FString> Strings;
-		GConfig->GetArray(TEXT("SlateIconReference"), TEXT("IgnoredStyleSets"), Strings, GEditorIni);
+		bCacheDirty = false;
+		SaveCache(GetCacheFilePath(), CacheFingerprint);
+	}
+}
 
-		TArray<FName> Names;
-		Algo::Transform(Strings, Names, [](const FString& S) -> FName { return FName(*S); });
+bool FSlateIconRefDataHelper::SaveCache(const FString& InFilePath, uint32 InFingerprint) const
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
 
-		IgnoredStyleSets = MoveTemp(Names);
+	uint32 Magic = SlateIconCatalogCache::FileMagic;
+	uint32 Version = SlateIconCatalogCache::FileVersion;
+	uint32 Fingerprint = InFingerprint;
+	int32 NumStyleSets = KnownStyleSets.Num();
+	int32 NumIcons = 0;
+	for (const TSharedPtr<FSlateStyleSetDescriptor>& Descriptor : KnownStyleSets)
+	{
+		NumIcons += Descriptor->NumIcons;
 	}
+	Writer << Magic << Version << Fingerprint << NumStyleSets << NumIcons;
 
-	KnownStyleSets.Empty();
-	KnownIconsMap.Empty();
-
-	FSlateStyleRegistry::IterateAllStyles([this](const ISlateStyle& Style)
+	for (const TSharedPtr<FSlateStyleSetDescriptor>& Descriptor : KnownStyleSets)
 	{
-		FName StyleName = Style.GetStyleSetName();
-		if (StyleName.IsNone() || (IgnoredStyleSets.IsSet() && IgnoredStyleSets.GetValue().Contains(StyleName)))
-			return true;
+		FString Name = Descriptor->Name.ToString();
+		FString ParentName = Descriptor->ParentStyleName.IsNone() ? FString() : Descriptor->ParentStyleName.ToString();
+		int32 NumBrushes = Descriptor->NumBrushes;
+		uint32 BrushHash = Descriptor->BrushHash;
+		int32 NumSetIcons = Descriptor->NumIcons;
+		bool bMaterialized = Descriptor->bMaterialized;
+		Writer << Name << ParentName << NumBrushes << BrushHash << NumSetIcons << bMaterialized;
+	}
 
-		UE_LOG(LogSlateIcon, Verbose, TEXT("Found style: %s"), *StyleName.ToString());
+	// lazily materialized ranges may be out of style set order, write them in order the reader expects
+	for (const TSharedPtr<FSlateStyleSetDescriptor>& Descriptor : KnownStyleSets)
+	{
+		for (int32 Id = Descriptor->FirstIcon; Id < Descriptor->FirstIcon + Descriptor->NumIcons; ++Id)
+		{
+			FString Name = IconNames[Id].ToString();
+			Writer << Name;
+		}
+	}
 
-		const FSlateStyleSet& SlateStyleSet = static_cast<const FSlateStyleSet&>(Style);
+	for (const TSharedPtr<FSlateStyleSetDescriptor>& Descriptor : KnownStyleSets)
+	{
+		Writer.Serialize(const_cast<uint8*>(IconFlags.GetData() + Descriptor->FirstIcon), Descriptor->NumIcons);
+	}
 
-		auto StyleRef = MakeShared<FSlateStyleSetDescriptor>();
-		StyleRef->Name = StyleName;
-#if !UE_VERSION_OLDER_THAN(5,0,0)
-		StyleRef->ParentStyleName = SlateStyleSet.*GParentStyleName;
-#endif
-		KnownStyleSets.Add(StyleRef);
+	for (const TSharedPtr<FSlateStyleSetDescriptor>& Descriptor : KnownStyleSets)
+	{
+		for (int32 Id = Descriptor->FirstIcon; Id < Descriptor->FirstIcon + Descriptor->NumIcons; ++Id)
+		{
+			uint64 SortKey = IconSortKeys[Id];
+			Writer << SortKey;
+		}
+	}
 
-		const FBrushResourcesMap& BrushResourcesMap = SlateStyleSet.*GBrushResources;
-		for (const auto& KeyToBrush : BrushResourcesMap)
+	// resource names repeat across icons, written once and referenced by index
+	TArray<FName> ResourceNames;
+	TMap<FName, int32> ResourceNameIndices;
+	for (const TSharedPtr<FSlateStyleSetDescriptor>& Descriptor : KnownStyleSets)
+	{
+		for (int32 Id = Descriptor->FirstIcon; Id < Descriptor->FirstIcon + Descriptor->NumIcons; ++Id)
 		{
-			if (!KeyToBrush.Key.IsNone() && KeyToBrush.Value)
+			const FName ResourceName = IconBrushInfos[Id].ResourceName;
+			if (!ResourceNameIndices.Contains(ResourceName))
 			{
-				UE_LOG(LogSlateIcon, Verbose, TEXT("Found item: %s.%s"), *StyleName.ToString(), *KeyToBrush.Key.ToString());
-
-				auto IconRef = MakeShared<FSlateIconDescriptor>();
-				IconRef->StyleSetName = StyleName;
-				IconRef->Name = KeyToBrush.Key;
-				StyleRef->Icons.Add(IconRef);
+				ResourceNameIndices.Add(ResourceName, ResourceNames.Add(ResourceName));
 			}
 		}
+	}
 
-		Algo::Sort(StyleRef->Icons, FDescriptorSorters());
+	int32 NumResourceNames = ResourceNames.Num();
+	Writer << NumResourceNames;
+	for (FName ResourceName : ResourceNames)
+	{
+		FString ResourceString = ResourceName.IsNone() ? FString() : ResourceName.ToString();
+		Writer << ResourceString;
+	}
 
-		return true;
-	});
+	for (const TSharedPtr<FSlateStyleSetDescriptor>& Descriptor : KnownStyleSets)
+	{
+		for (int32 Id = Descriptor->FirstIcon; Id < Descriptor->FirstIcon + Descriptor->NumIcons; ++Id)
+		{
+			FSlateIconBrushInfo Info = IconBrushInfos[Id];
+			int32 ResourceIndex = ResourceNameIndices.FindChecked(Info.ResourceName);
+			Writer << ResourceIndex << Info.ImageWidth << Info.ImageHeight << Info.DrawType << Info.ImageType << Info.Tiling;
+		}
+	}
+
+	return FFileHelper::SaveArrayToFile(Bytes, *InFilePath);
+}
+
+void FSlateIconRefDataHelper::RebuildIconLookup()
+{
+	ResolveStyleSetParents();
 
-	Algo::Sort(KnownStyleSets, FDescriptorSorters());
+	IconOwnerIndex.Reset();
+	IconOwnerIndex.Reserve(IconNames.Num());
+	NextIconOwner.Init(InvalidSlateIconId, IconNames.Num());
 
-	TArray<TSharedPtr<FSlateIconDescriptor>> Temp; 
-	for (TSharedPtr<FSlateStyleSetDescriptor>& Descriptor : KnownStyleSets)
+	for (FSlateIconId Id = 0; Id < (FSlateIconId)IconNames.Num(); ++Id)
 	{
-		Temp.Empty();
-		GatherIconData(false, Descriptor->Name, true, Temp);
+		LinkIconOwner(IconOwnerIndex, NextIconOwner, IconNames[Id], Id);
+	}
+}
 
-		for (const TSharedPtr<FSlateIconDescriptor>& Icon : Temp)
-		{
-			KnownIconsMap.Add(MakeTuple(Descriptor->Name, Icon->Name), Icon);
-		}
+void FSlateIconRefDataHelper::ResolveStyleSetParents()
+{
+	for (const TSharedPtr<FSlateStyleSetDescriptor>& Descriptor : KnownStyleSets)
+	{
+		const int32* ParentIndex = Descriptor->ParentStyleName.IsNone() ? nullptr : KnownStyleSetIndices.Find(Descriptor->ParentStyleName);
+		Descriptor->ParentIndex = ParentIndex ? *ParentIndex : INDEX_NONE;
 	}
 }
 
 void FSlateIconRefDataHelper::ClearStyleData()
 {
-	KnownIconsMap.Empty();
+	CancelBuild();
+
+	IconOwnerIndex.Empty();
+	NextIconOwner.Empty();
 	KnownStyleSets.Empty();
+	KnownStyleSetIndices.Empty();
+	IconNames.Empty();
+	IconStyleSets.Empty();
+	IconFlags.Empty();
+	IconSortKeys.Empty();
+	IconBrushInfos.Empty();
+	IconViews.Empty();
+	NextIconViewPrune = 0;
+	UnknownStyleSets.Empty();
+	UnknownIcons.Empty();
+
+	if (FramePinTickHandle.IsValid())
+	{
+#if !UE_VERSION_OLDER_THAN(5,0,0)
+		FTSTicker::GetCoreTicker().RemoveTicker(FramePinTickHandle);
+#else
+		FTicker::GetCoreTicker().RemoveTicker(FramePinTickHandle);
+#endif
+		FramePinTickHandle.Reset();
+	}
+	FramePinnedBrushes.Empty();
+}
+
+const FSlateBrush* FSlateIconRefDataHelper::PinForFrame(const TSharedPtr<FSlateDynamicImageBrush>& Brush)
+{
+	if (!Brush.IsValid())
+	{
+		return nullptr;
+	}
+
+	// same few brushes are requested by every paint
+	FramePinnedBrushes.AddUnique(Brush);
+
+	if (!FramePinTickHandle.IsValid())
+	{
+#if !UE_VERSION_OLDER_THAN(5,0,0)
+		FramePinTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FSlateIconRefDataHelper::HandleFramePinTick));
+#else
+		FramePinTickHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FSlateIconRefDataHelper::HandleFramePinTick));
+#endif
+	}
+
+	return Brush.Get();
+}
+
+bool FSlateIconRefDataHelper::HandleFramePinTick(float DeltaTime)
+{
+	FramePinTickHandle.Reset();
+	FramePinnedBrushes.Reset();
+	return false;
 }
 
 void FSlateIconRefDataHelper::GatherStyleData(bool bAllowNone, TArray<TSharedPtr<FSlateStyleSetDescriptor>>& OutArray)
@@ -176,22 +1384,93 @@ void FSlateIconRefDataHelper::GatherIconData(bool bAllowNone, FName StyleSetName
 	if (bAllowNone)
 		OutArray.Add(EmptyImage);
 
-	if (!bRecursive)
+	TArray<FSlateIconId> Ids;
+	GatherIconIds(StyleSetName, bRecursive, Ids);
+
+	OutArray.Reserve(OutArray.Num() + Ids.Num());
+	for (FSlateIconId Id : Ids)
+	{
+		OutArray.Add(GetIconDescriptor(Id));
+	}
+}
+
+void FSlateIconRefDataHelper::GatherIconIds(FName StyleSetName, bool bRecursive, TArray<FSlateIconId>& OutIds)
+{
+	if (StyleSetName.IsNone())
+		return;
+
+	TSharedPtr<FSlateStyleSetDescriptor> Descriptor = FindStyleSet(StyleSetName, false);
+	ensure(Descriptor.IsValid());
+
+	if (bRecursive)
 	{
-		OutArray.Append(FindStyleSet(StyleSetName, false)->GetRegisteredIcons());
+		const TArray<FSlateIconId>& Ids = GetInheritedIcons(*Descriptor);
+
+		OutIds.Append(Ids);
 	}
 	else
 	{
-		while (!StyleSetName.IsNone())
+		MaterializeStyleSet(*Descriptor);
+
+		OutIds.Reserve(OutIds.Num() + Descriptor->NumIcons);
+		for (int32 Id = Descriptor->FirstIcon; Id < Descriptor->FirstIcon + Descriptor->NumIcons; ++Id)
+		{
+			OutIds.Add(Id);
+		}
+	}
+}
+
+const TArray<FSlateIconId>& FSlateIconRefDataHelper::GetInheritedIcons(FSlateStyleSetDescriptor& StyleSet)
+{
+	if (StyleSet.bInheritedIconsValid)
+	{
+		return StyleSet.InheritedIcons;
+	}
+
+	// each style set range is already in collation order, merge the runs of the whole chain
+	struct FRun
+	{
+		int32 Next;
+		int32 End;
+	};
+
+	TArray<FRun, TInlineAllocator<8>> Runs;
+	int32 NumIcons = 0;
+
+	FSlateStyleSetDescriptor* Current = &StyleSet;
+	while (Current && Current->Index != INDEX_NONE && Runs.Num() < SlateIconCollation::MaxInheritanceDepth)
+	{
+		MaterializeStyleSet(*Current);
+		if (Current->NumIcons)
 		{
-			TSharedPtr<FSlateStyleSetDescriptor> Descriptor = FindStyleSet(StyleSetName, false);
-			ensure(Descriptor.IsValid());
-			OutArray.Append(Descriptor->GetRegisteredIcons());
-			StyleSetName = Descriptor->ParentStyleName;
+			Runs.Add({ Current->FirstIcon, Current->FirstIcon + Current->NumIcons });
+			NumIcons += Current->NumIcons;
 		}
 
-		Algo::Sort(OutArray, FDescriptorSorters());
+		Current = Current->ParentIndex != INDEX_NONE ? KnownStyleSets[Current->ParentIndex].Get() : nullptr;
+	}
+
+	TArray<FSlateIconId>& Result = StyleSet.InheritedIcons;
+	Result.Reset(NumIcons);
+
+	// chains are short, picking the smallest head by linear scan beats a heap; ties keep the child first
+	while (Result.Num() < NumIcons)
+	{
+		int32 Best = INDEX_NONE;
+		for (int32 RunIndex = 0; RunIndex < Runs.Num(); ++RunIndex)
+		{
+			const FRun& Run = Runs[RunIndex];
+			if (Run.Next < Run.End && (Best == INDEX_NONE
+				|| SlateIconCollation::Less(IconSortKeys[Run.Next], IconNames[Run.Next], IconSortKeys[Runs[Best].Next], IconNames[Runs[Best].Next])))
+			{
+				Best = RunIndex;
+			}
+		}
+		Result.Add(Runs[Best].Next++);
 	}
+
+	StyleSet.bInheritedIconsValid = true;
+	return Result;
 }
 
 TSharedPtr<FSlateStyleSetDescriptor> FSlateIconRefDataHelper::FindStyleSet(FName StyleSetName, bool bMakeUnknown)
@@ -201,16 +1480,26 @@ TSharedPtr<FSlateStyleSetDescriptor> FSlateIconRefDataHelper::FindStyleSet(FName
 		return EmptyStyleSet;
 	}
 
-	if (auto* Found = KnownStyleSets.FindByKey<FDescriptorFinder>(StyleSetName))
+	if (const int32* Found = KnownStyleSetIndices.Find(StyleSetName))
 	{
-		return *Found;
+		return KnownStyleSets[*Found];
 	}
 
 	if (bMakeUnknown)
 	{
+		if (const TSharedPtr<FSlateStyleSetDescriptor>* Interned = UnknownStyleSets.Find(StyleSetName))
+		{
+			return *Interned;
+		}
+
+		TrimUnknownDescriptors(UnknownStyleSets);
+
 		TSharedPtr<FSlateStyleSetDescriptor> Unknown = MakeShared<FSlateStyleSetDescriptor>();
 		Unknown->Name = StyleSetName;
-		Unknown->bUnknown = true;
+		// excluded style sets are hidden from pickers but still resolve for existing references,
+		// names looked up before the first catalog is published are left to the registry
+		Unknown->bUnknown = !IsAwaitingFirstBuild() && !IsIgnoredStyleSet(StyleSetName);
+		UnknownStyleSets.Add(StyleSetName, Unknown);
 		return Unknown;
 	}
 
@@ -224,41 +1513,208 @@ TSharedPtr<FSlateIconDescriptor> FSlateIconRefDataHelper::FindIcon(FName StyleSe
 		return EmptyImage;
 	}
 
-	if (auto* QuickLookup = KnownIconsMap.Find(MakeTuple(StyleSetName, IconName)))
+	if (const int32* StyleSetIndex = KnownStyleSetIndices.Find(StyleSetName))
 	{
-		return *QuickLookup;
+		const FSlateIconId Id = FindEffectiveIcon(*KnownStyleSets[*StyleSetIndex], IconName);
+		if (Id != InvalidSlateIconId)
+		{
+			return GetIconDescriptor(Id);
+		}
 	}
 
-	if (auto* StyleSet = KnownStyleSets.FindByKey<FDescriptorFinder>(StyleSetName))
+	if (bMakeUnknown)
 	{
-		if (auto* Icon = (*StyleSet)->Icons.FindByKey<FDescriptorFinder>(IconName))
-		{
-			return *Icon;
-		}
+		// dynamic brushes come and go without touching the catalog, whether one is held is checked on every lookup
+		const bool bDynamic = Switches::bWithDynamicBrushes && KnownStyleSetIndices.Contains(StyleSetName) && !IsIgnoredIcon(IconName)
+			&& HasDynamicBrush(FSlateStyleRegistry::FindSlateStyle(StyleSetName), IconName);
 
-		const FName ParentStyleName = (*StyleSet)->ParentStyleName;
-		if (!ParentStyleName.IsNone())
+		const TPair<FName, FName> Key(StyleSetName, IconName);
+		if (const TSharedPtr<FSlateIconDescriptor>* Interned = UnknownIcons.Find(Key))
 		{
-			return FindIcon(ParentStyleName, IconName, bMakeUnknown);
+			if ((*Interned)->bDynamic == bDynamic)
+			{
+				return *Interned;
+			}
 		}
-	}
 
-	if (bMakeUnknown)
-	{
+		TrimUnknownDescriptors(UnknownIcons);
+
 		TSharedPtr<FSlateIconDescriptor> Unknown = MakeShared<FSlateIconDescriptor>();
 		Unknown->StyleSetName = StyleSetName;
 		Unknown->Name = IconName;
-		Unknown->bUnknown = true;
+		Unknown->bDynamic = bDynamic;
+		Unknown->bUnknown = !bDynamic && !IsAwaitingFirstBuild() && !IsIgnoredStyleSet(StyleSetName) && !IsIgnoredIcon(IconName);
+		UnknownIcons.Add(Key, Unknown);
 		return Unknown;
 	}
 
 	return EmptyImage;
 }
 
+template <typename KeyType, typename DescriptorType>
+void FSlateIconRefDataHelper::TrimUnknownDescriptors(TMap<KeyType, TSharedPtr<DescriptorType>>& Interned)
+{
+	if (Interned.Num() < SlateIconInterning::MaxUnknownDescriptors)
+	{
+		return;
+	}
+
+	// drop descriptors nobody else references, widgets holding the rest keep their pointers either way
+	for (auto It = Interned.CreateIterator(); It; ++It)
+	{
+		if (It.Value().IsUnique())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	if (Interned.Num() >= SlateIconInterning::MaxUnknownDescriptors)
+	{
+		Interned.Reset();
+	}
+}
+
+FSlateIconId FSlateIconRefDataHelper::FindRegisteredIcon(const FSlateStyleSetDescriptor& StyleSet, FName IconName) const
+{
+	const FSlateIconId* Head = IconOwnerIndex.Find(IconName);
+	for (FSlateIconId Id = Head ? *Head : InvalidSlateIconId; Id != InvalidSlateIconId; Id = NextIconOwner[Id])
+	{
+		if (IconStyleSets[Id] == StyleSet.Index)
+		{
+			return Id;
+		}
+	}
+	return InvalidSlateIconId;
+}
+
+FSlateIconId FSlateIconRefDataHelper::FindEffectiveIcon(FSlateStyleSetDescriptor& StyleSet, FName IconName)
+{
+	// owners are only known for materialized sets
+	int32 Depth = 0;
+	for (FSlateStyleSetDescriptor* Current = &StyleSet; Current && Depth < SlateIconCollation::MaxInheritanceDepth; ++Depth)
+	{
+		MaterializeStyleSet(*Current);
+		Current = Current->ParentIndex != INDEX_NONE ? KnownStyleSets[Current->ParentIndex].Get() : nullptr;
+	}
+
+	const FSlateIconId* Head = IconOwnerIndex.Find(IconName);
+	if (!Head)
+	{
+		return InvalidSlateIconId;
+	}
+
+	// few style sets register the same name, walk lineage and pick nearest owner
+	Depth = 0;
+	for (int32 Index = StyleSet.Index; Index != INDEX_NONE && Depth < SlateIconCollation::MaxInheritanceDepth; Index = KnownStyleSets[Index]->ParentIndex, ++Depth)
+	{
+		for (FSlateIconId Id = *Head; Id != InvalidSlateIconId; Id = NextIconOwner[Id])
+		{
+			if (IconStyleSets[Id] == Index)
+			{
+				return Id;
+			}
+		}
+	}
+	return InvalidSlateIconId;
+}
+
+TSharedPtr<FSlateIconDescriptor> FSlateIconRefDataHelper::GetIconDescriptor(FSlateIconId Id)
+{
+	check(IconNames.IsValidIndex(Id));
+
+	if (IconViews.Num() >= NextIconViewPrune)
+	{
+		for (auto It = IconViews.CreateIterator(); It; ++It)
+		{
+			if (!It.Value().IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+		NextIconViewPrune = FMath::Max(1024, IconViews.Num() * 2);
+	}
+
+	TWeakPtr<FSlateIconDescriptor>& View = IconViews.FindOrAdd(Id);
+	if (TSharedPtr<FSlateIconDescriptor> Pinned = View.Pin())
+	{
+		return Pinned;
+	}
+
+	TSharedPtr<FSlateIconDescriptor> Result = MakeShared<FSlateIconDescriptor>(MakeIconView(Id));
+	View = Result;
+	return Result;
+}
+
+FSlateIconDescriptor FSlateIconRefDataHelper::MakeIconView(FSlateIconId Id) const
+{
+	check(IconNames.IsValidIndex(Id));
+
+	FSlateIconDescriptor Result;
+	Result.StyleSetName = KnownStyleSets[IconStyleSets[Id]]->Name;
+	Result.Name = IconNames[Id];
+	Result.Id = Id;
+	return Result;
+}
+
+SIZE_T FSlateIconRefDataHelper::GetAllocatedSize() const
+{
+	SIZE_T Result = KnownStyleSets.GetAllocatedSize() + KnownStyleSets.Num() * sizeof(FSlateStyleSetDescriptor);
+	Result += KnownStyleSetIndices.GetAllocatedSize();
+	Result += IconNames.GetAllocatedSize() + IconStyleSets.GetAllocatedSize() + IconFlags.GetAllocatedSize() + IconSortKeys.GetAllocatedSize() + IconBrushInfos.GetAllocatedSize();
+	for (const TSharedPtr<FSlateStyleSetDescriptor>& Descriptor : KnownStyleSets)
+	{
+		Result += Descriptor->InheritedIcons.GetAllocatedSize();
+	}
+	Result += IconOwnerIndex.GetAllocatedSize() + NextIconOwner.GetAllocatedSize();
+	Result += IconViews.GetAllocatedSize() + IconViews.Num() * sizeof(FSlateIconDescriptor);
+	Result += UnknownStyleSets.GetAllocatedSize() + UnknownStyleSets.Num() * sizeof(FSlateStyleSetDescriptor);
+	Result += UnknownIcons.GetAllocatedSize() + UnknownIcons.Num() * sizeof(FSlateIconDescriptor);
+	return Result;
+}
+
+void FSlateIconRefDataHelper::DumpMemoryStats(FOutputDevice& Ar) const
+{
+	int32 NumLiveViews = 0;
+	for (const auto& IdToView : IconViews)
+	{
+		NumLiveViews += IdToView.Value.IsValid() ? 1 : 0;
+	}
+
+	Ar.Logf(TEXT("Slate icon catalog: %d style sets, %d icons, %d live views, %d expired views"), KnownStyleSets.Num(), IconNames.Num(), NumLiveViews, IconViews.Num() - NumLiveViews);
+	Ar.Logf(TEXT("  Style sets: %llu bytes"), (uint64)(KnownStyleSets.GetAllocatedSize() + KnownStyleSets.Num() * sizeof(FSlateStyleSetDescriptor) + KnownStyleSetIndices.GetAllocatedSize()));
+	Ar.Logf(TEXT("  Icon arrays: %llu bytes"), (uint64)(IconNames.GetAllocatedSize() + IconStyleSets.GetAllocatedSize() + IconFlags.GetAllocatedSize() + IconSortKeys.GetAllocatedSize()));
+	Ar.Logf(TEXT("  Brush info: %llu bytes"), (uint64)IconBrushInfos.GetAllocatedSize());
+	Ar.Logf(TEXT("  Icon lookup: %llu bytes"), (uint64)(IconOwnerIndex.GetAllocatedSize() + NextIconOwner.GetAllocatedSize()));
+
+	int32 MaxDepth = 0;
+	for (const TSharedPtr<FSlateStyleSetDescriptor>& Descriptor : KnownStyleSets)
+	{
+		int32 Depth = 0;
+		for (int32 Index = Descriptor->Index; Index != INDEX_NONE && Depth < SlateIconCollation::MaxInheritanceDepth; Index = KnownStyleSets[Index]->ParentIndex)
+		{
+			++Depth;
+		}
+		MaxDepth = FMath::Max(MaxDepth, Depth);
+	}
+	Ar.Logf(TEXT("  Unique icon names: %d, deepest style chain: %d"), IconOwnerIndex.Num(), MaxDepth);
+	Ar.Logf(TEXT("  Icon views: %llu bytes"), (uint64)(IconViews.GetAllocatedSize() + IconViews.Num() * sizeof(FSlateIconDescriptor)));
+	Ar.Logf(TEXT("  Unknown descriptors: %d style sets, %d icons"), UnknownStyleSets.Num(), UnknownIcons.Num());
+	Ar.Logf(TEXT("  Total: %llu bytes"), (uint64)GetAllocatedSize());
+	Ar.Logf(TEXT("Last build: %d of %d style sets, %d icons, snapshot %.2f ms, %s build %.2f ms, publish %.2f ms"),
+		LastBuildStats.NumRescanned, LastBuildStats.NumStyleSets, LastBuildStats.NumIcons, LastBuildStats.SnapshotSeconds * 1000.0,
+		LastBuildStats.bParallel ? TEXT("parallel") : TEXT("serial"), LastBuildStats.BuildSeconds * 1000.0, LastBuildStats.PublishSeconds * 1000.0);
+}
+
 // =============================================================
 
 const FSlateBrush* FSlateIconDescriptor::GetBrushSafe() const
 {
+	if (bDynamic)
+	{
+		const FSlateBrush* Result = GetBrush();
+		return Result ? Result : FStyleDefaults::GetNoBrush();
+	}
+
 	if (!bUnknown)
 	{
 		const ISlateStyle* StyleSet = FSlateStyleRegistry::FindSlateStyle(StyleSetName);
@@ -278,9 +1734,15 @@ const FSlateBrush* FSlateIconDescriptor::GetBrush() const
 	if (!bUnknown)
 	{
 		const ISlateStyle* StyleSet = FSlateStyleRegistry::FindSlateStyle(StyleSetName);
+		if (StyleSet && bDynamic)
+		{
+			// style set holds it weakly, pinned until next frame so it cannot expire while drawn
+			return FSlateIconRefDataHelper::GetDataSource().PinForFrame(FindDynamicBrush(StyleSet, Name));
+		}
 		if (StyleSet)
 		{
-			return StyleSet->GetBrush(Name);
+			// no default brush fallback, icons missing from registry must read as unknown
+			return StyleSet->GetOptionalBrush(Name, nullptr, nullptr);
 		}
 	}
 	return nullptr;
@@ -288,14 +1750,44 @@ const FSlateBrush* FSlateIconDescriptor::GetBrush() const
 
 FText FSlateIconDescriptor::GetDisplayText() const
 {
-	return DisplayTextOverride.IsSet() ? DisplayTextOverride.GetValue() : FText::FromName(Name);
+	return IsNone() ? LOCTEXT("EmptyImageName", "None") : FText::FromName(Name);
 }
 
 bool FSlateIconDescriptor::IsUnknown() const
 {
+	if (bDynamic)
+	{
+		return !HasDynamicBrush(FSlateStyleRegistry::FindSlateStyle(StyleSetName), Name);
+	}
 	return bUnknown || (!Name.IsNone() && !GetBrush());
 }
 
+uint8 FSlateIconDescriptor::GetFlags() const
+{
+	if (bDynamic)
+	{
+		return ESlateIconFlags::Dynamic;
+	}
+
+	const FSlateIconRefDataHelper& DataSource = FSlateIconRefDataHelper::GetDataSource();
+	// views may outlive the catalog they were made for
+	if (Id < (FSlateIconId)DataSource.GetNumIcons() && DataSource.GetIconName(Id) == Name)
+	{
+		return DataSource.GetIconFlags(Id);
+	}
+	return ESlateIconFlags::None;
+}
+
+const FSlateIconBrushInfo* FSlateIconDescriptor::GetBrushInfo() const
+{
+	const FSlateIconRefDataHelper& DataSource = FSlateIconRefDataHelper::GetDataSource();
+	if (Id < (FSlateIconId)DataSource.GetNumIcons() && DataSource.GetIconName(Id) == Name)
+	{
+		return &DataSource.GetIconBrushInfo(Id);
+	}
+	return nullptr;
+}
+
 // =============================================================
 
 const ISlateStyle* FSlateStyleSetDescriptor::GetStyleSet() const
@@ -5,24 +5,68 @@
 #include "Styling/SlateStyle.h"
 #include "Styling/SlateBrush.h"
 #include "Templates/SharedPointer.h"
+#include "Templates/UniquePtr.h"
 #include "Templates/UnrealTemplate.h"
 #include "Containers/Array.h"
-#include "Templates/UnrealTemplate.h"
+#include "Containers/Ticker.h"
+#include "Delegates/Delegate.h"
+#include "Misc/EngineVersionComparison.h"
+#include "SlateIconNameFilter.h"
 
 class SToolTip;
+struct FSlateDynamicImageBrush;
 class IPropertyHandle;
 struct FSlateIconReference;
 class FSlateIconRefDataHelper;
 
 /**
- * Represents information about slate icon
+ * Index of an icon in the flat catalog of FSlateIconRefDataHelper
+ */
+using FSlateIconId = uint32;
+constexpr FSlateIconId InvalidSlateIconId = MAX_uint32;
+
+namespace ESlateIconFlags
+{
+	enum Type : uint8
+	{
+		None = 0,
+		// brush references an image resource
+		HasResource = 1 << 0,
+		// brush draws nothing
+		NoDrawType = 1 << 1,
+		// dynamic image brush held weakly by style set, found on lookup and never cataloged, may expire at any time
+		Dynamic = 1 << 2,
+	};
+}
+
+/**
+ * Brush properties captured at scan time so filters and sorts never touch the registry
+ */
+struct FSlateIconBrushInfo
+{
+	FName				ResourceName;
+	// image size rounded and clamped to 16 bits
+	uint16				ImageWidth = 0;
+	uint16				ImageHeight = 0;
+	// ESlateBrushDrawType, ESlateBrushImageType and ESlateBrushTileType values
+	uint8				DrawType = 0;
+	uint8				ImageType = 0;
+	uint8				Tiling = 0;
+};
+
+/**
+ * Represents information about slate icon.
+ * Known icons are lightweight views over the flat catalog created on demand.
  */
 struct FSlateIconDescriptor
 {
 	FName				StyleSetName;
 	FName				Name;
-	TOptional<FText>	DisplayTextOverride;
+	// catalog entry this view was made for, invalid for none and unknown icons
+	FSlateIconId		Id = InvalidSlateIconId;
 	bool				bUnknown = false; // is known image
+	// dynamic image brush of a known style set, resolved on every GetBrush and kept alive until next frame
+	bool				bDynamic = false;
 
 	const FName& GetID() const { return Name; }
 	// null-safe getbrush
@@ -32,6 +76,9 @@ struct FSlateIconDescriptor
 	FText GetDisplayText() const;
 	bool IsNone() const { return Name.IsNone(); }
 	bool IsUnknown() const;
+	uint8 GetFlags() const;
+	// captured brush properties, null for icons not in catalog
+	const FSlateIconBrushInfo* GetBrushInfo() const;
 
 	bool operator<(const FSlateIconDescriptor& Other) const { return Name.Compare(Other.Name) < 0; }
 	bool operator==(const FSlateIconDescriptor& Other) const { return StyleSetName == Other.StyleSetName && Name == Other.Name; }
@@ -48,22 +95,54 @@ struct FSlateStyleSetDescriptor
 	TOptional<FText>	DisplayTextOverride;
 	// is this descriptor for an unknown (not registered anywhere) style set
 	bool				bUnknown = false;
-	// icons registered within this particular style set
-	TArray<TSharedPtr<FSlateIconDescriptor>> Icons;
+	// index in KnownStyleSets
+	int32				Index = INDEX_NONE;
+	// index of parent style set in KnownStyleSets
+	int32				ParentIndex = INDEX_NONE;
+	// range of icons registered within this particular style set in the flat catalog
+	int32				FirstIcon = 0;
+	int32				NumIcons = 0;
+	// brush count at the time of scan, used to detect changes
+	int32				NumBrushes = 0;
+	// order independent hash of brush names and captured properties, stable between sessions, zero while not materialized
+	uint32				BrushHash = 0;
+	// icon range has been filled, lazy catalog leaves it empty until first use
+	bool				bMaterialized = false;
+	// own and inherited icons in collation order, valid until the catalog is rebuilt
+	bool				bInheritedIconsValid = false;
+	TArray<FSlateIconId> InheritedIcons;
 
 	const FName& GetID() const { return Name; }
 	const ISlateStyle* GetStyleSet() const;
 	FText GetDisplayText() const;
 	bool IsNone() const { return Name.IsNone(); }
 	bool IsUnknown() const;
-	const TArray<TSharedPtr<FSlateIconDescriptor>>& GetRegisteredIcons() const { return Icons; }
-	int32 GetNumRegisteredIcons() const { return Icons.Num(); }
+	int32 GetNumRegisteredIcons() const { return NumIcons; }
 
 	bool operator< (const FSlateStyleSetDescriptor& Other) const { return Name.Compare(Other.Name) < 0; }
 	bool operator==(const FSlateStyleSetDescriptor& Other) const { return Name == Other.Name; }
 	bool operator==(const FName& Other) const { return Name == Other; }
 };
 
+/**
+ * Timings of the last published catalog build, snapshot and publish run on game thread and build on worker
+ */
+struct FSlateIconCatalogBuildStats
+{
+	int32				NumStyleSets = 0;
+	int32				NumRescanned = 0;
+	int32				NumIcons = 0;
+	bool				bParallel = false;
+	double				SnapshotSeconds = 0.0;
+	double				BuildSeconds = 0.0;
+	double				PublishSeconds = 0.0;
+};
+
+/**
+ * Broadcast after catalog content changed with names of style sets that were added, rescanned or removed
+ */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnSlateIconCatalogChanged, const TArray<FName>& /* ChangedStyleSets */);
+
 /**
  * Style data storage
  */
@@ -72,31 +151,166 @@ class FSlateIconRefDataHelper : public FNoncopyable
 public:
 	static FSlateIconRefDataHelper& GetDataSource();
 
+	~FSlateIconRefDataHelper();
+
 	void SetupStyleData();
 	void ClearStyleData();
 
-	void ForceRescan() { bInitialized = false; }
+	// drop everything and rebuild on next setup, optionally without reading the disk cache
+	void ForceRescan(bool bIgnoreDiskCache = false) { bInitialized = false; bSkipDiskCache = bIgnoreDiskCache; }
+	// update changed style sets on next setup
+	void RequestRescan() { bRescanPending = true; }
+	// catalog is being assembled on a worker, published data stays readable meanwhile
+	bool IsBuildInProgress() const { return PendingBuild.IsValid(); }
+	// nothing published yet, lookups hand out neutral descriptors validated against the registry
+	bool IsAwaitingFirstBuild() const { return IsBuildInProgress() && KnownStyleSets.Num() == 0; }
+	// block until pending build is done and publish it, follow-up rescans may start another one
+	void FinishBuild();
+	const FSlateIconCatalogBuildStats& GetLastBuildStats() const { return LastBuildStats; }
+	// cheap check for style sets registered, removed or modified since last scan, hashes a few sets per call
+	bool DetectChangedStyleSets();
 
 	void GatherStyleData(bool bAllowNone, TArray<TSharedPtr<FSlateStyleSetDescriptor>>& OutArray);
+	// shared view for every listed icon, prefer ids when most of them are filtered out or never shown
 	void GatherIconData(bool bAllowNone, FName StyleSetName, bool bRecursive, TArray<TSharedPtr<FSlateIconDescriptor>>& OutArray);
+	// listed icons without making views
+	void GatherIconIds(FName StyleSetName, bool bRecursive, TArray<FSlateIconId>& OutIds);
 
 	TSharedPtr<FSlateStyleSetDescriptor> FindStyleSet(FName StyleSetName, bool bMakeUnknown = true);
 	TSharedPtr<FSlateIconDescriptor> FindIcon(FName StyleSetName, FName IconName, bool bMakeUnknown = true);
 
 	TArray<TSharedPtr<FSlateStyleSetDescriptor>> const& GetStyleSets() const { return KnownStyleSets; }
 
+	// icon id registered directly within style set, parents are not searched
+	FSlateIconId FindRegisteredIcon(const FSlateStyleSetDescriptor& StyleSet, FName IconName) const;
+	// shared view for catalog entry, reused while anyone holds it
+	TSharedPtr<FSlateIconDescriptor> GetIconDescriptor(FSlateIconId Id);
+	// temporary view for catalog entry, for filtering before shared views are made
+	FSlateIconDescriptor MakeIconView(FSlateIconId Id) const;
+	// merged icons of style set and its parents, computed once per catalog layout
+	const TArray<FSlateIconId>& GetInheritedIcons(FSlateStyleSetDescriptor& StyleSet);
+
+	FName GetIconName(FSlateIconId Id) const { return IconNames[Id]; }
+	uint8 GetIconFlags(FSlateIconId Id) const { return IconFlags[Id]; }
+	const FSlateIconBrushInfo& GetIconBrushInfo(FSlateIconId Id) const { return IconBrushInfos[Id]; }
+	int32 GetNumIcons() const { return IconNames.Num(); }
+
+	SIZE_T GetAllocatedSize() const;
+	void DumpMemoryStats(FOutputDevice& Ar) const;
+
+	// on-disk copy of the catalog, valid while the registry fingerprint matches; read in full, sets whose brushes
+	// no longer match their stored hash are loaded empty and left for the next scan
+	static FString GetCacheFilePath();
+	uint32 ComputeRegistryFingerprint() const;
+	bool LoadCache(const FString& InFilePath, uint32 InFingerprint);
+	bool SaveCache(const FString& InFilePath, uint32 InFingerprint) const;
+	// write catalog now if it changed since last save, otherwise it is written once changes settle
+	void FlushCache();
+
+	// hold dynamic brush until next frame so it outlives the paint it was requested for
+	const FSlateBrush* PinForFrame(const TSharedPtr<FSlateDynamicImageBrush>& Brush);
+
+	// changed every time catalog content changes, zero is reserved for "never seen"
+	uint32 GetGeneration() const { return CatalogGeneration; }
+	// fired on game thread after generation changed
+	FOnSlateIconCatalogChanged& OnCatalogChanged() { return CatalogChangedEvent; }
+
+private:
+	struct FStyleDataBuild;
+
+	// read include and exclude rules from editor config once
+	void CompileFilters();
+	bool IsIgnoredStyleSet(FName StyleSetName) const;
+	bool IsIgnoredIcon(FName IconName) const;
+	// diff registered style sets against known ones on game thread, null if nothing changed
+	TUniquePtr<FStyleDataBuild> SnapshotStyleData();
+	// sort rescanned style sets and assemble flat catalog, safe to run off game thread as it reads plain data only
+	static void BuildStyleData(FStyleDataBuild& Build);
+	// swap assembled catalog in and remap live descriptors and views
+	void PublishStyleData(FStyleDataBuild& Build);
+	bool HandleBuildTick(float DeltaTime);
+	void CancelBuild();
+	void NotifyCatalogChanged(const TArray<FName>& ChangedStyleSets);
+	// schedule debounced cache write
+	void MarkCacheDirty();
+	bool HandleCacheFlushTick(float DeltaTime);
+	bool HandleFramePinTick(float DeltaTime);
+	// enumerate, sort and index brushes of style set on first use
+	void MaterializeStyleSet(FSlateStyleSetDescriptor& Descriptor);
+	// resolve parent indices and owner index after catalog layout changed
+	void RebuildIconLookup();
+	void ResolveStyleSetParents();
+	// icon visible in style set, own icons take precedence over the nearest parent
+	FSlateIconId FindEffectiveIcon(FSlateStyleSetDescriptor& StyleSet, FName IconName);
+	// keep intern table bounded before adding another unknown descriptor
+	template <typename KeyType, typename DescriptorType>
+	static void TrimUnknownDescriptors(TMap<KeyType, TSharedPtr<DescriptorType>>& Interned);
+
 public:
 	bool bInitialized = false;
+	bool bRescanPending = false;
+	// next cold start builds from registry even if disk cache matches
+	bool bSkipDiskCache = false;
+	// round-robin position of brush hashing in DetectChangedStyleSets
+	int32 NextHashedStyleSet = 0;
+	// catalog has data not yet written to disk cache
+	bool bCacheDirty = false;
+	double LastCacheChangeTime = 0.0;
+#if !UE_VERSION_OLDER_THAN(5,0,0)
+	FTSTicker::FDelegateHandle CacheFlushTickHandle;
+#else
+	FDelegateHandle CacheFlushTickHandle;
+#endif
+	uint32 CacheFingerprint = 0;
+	uint32 CatalogGeneration = 1;
+	FOnSlateIconCatalogChanged CatalogChangedEvent;
+	// catalog build running on thread pool and ticker waiting for it, released on game thread once the worker is done
+	TUniquePtr<FStyleDataBuild> PendingBuild;
+	FSlateIconCatalogBuildStats LastBuildStats;
+#if !UE_VERSION_OLDER_THAN(5,0,0)
+	FTSTicker::FDelegateHandle BuildTickHandle;
+#else
+	FDelegateHandle BuildTickHandle;
+#endif
+
+	// dynamic brushes handed out this frame
+	TArray<TSharedPtr<FSlateDynamicImageBrush>> FramePinnedBrushes;
+#if !UE_VERSION_OLDER_THAN(5,0,0)
+	FTSTicker::FDelegateHandle FramePinTickHandle;
+#else
+	FDelegateHandle FramePinTickHandle;
+#endif
 
 	TSharedPtr<FSlateStyleSetDescriptor> EmptyStyleSet;
 	TSharedPtr<FSlateStyleSetDescriptor> AutoStyleSet;
 	TSharedPtr<FSlateIconDescriptor> EmptyImage;
 	
-	// ignored stylesets
-	TOptional<TArray<FName>> IgnoredStyleSets;
+	// style set and icon rules from [SlateIconReference] in editor config, excluded items never enter catalog
+	bool bFiltersCompiled = false;
+	FSlateIconNameFilter StyleSetFilter;
+	FSlateIconNameFilter IconFilter;
 	// all discovered stylesets
 	TArray<TSharedPtr<FSlateStyleSetDescriptor>> KnownStyleSets;
-	// searchable icon map
-	using FImageKey = TPair<FName, FName>;
-	TMap<FImageKey, TSharedPtr<FSlateIconDescriptor>> KnownIconsMap;
+	// style set name to index in KnownStyleSets
+	TMap<FName, int32> KnownStyleSetIndices;
+	// flat icon catalog, each style set owns a sorted contiguous range
+	TArray<FName> IconNames;
+	// owning style set index for each icon
+	TArray<uint16> IconStyleSets;
+	// ESlateIconFlags for each icon
+	TArray<uint8> IconFlags;
+	// collation prefix for each icon, see SlateIconCollation
+	TArray<uint64> IconSortKeys;
+	// brush properties for each icon
+	TArray<FSlateIconBrushInfo> IconBrushInfos;
+	// icon name to one of icons registered under that name, others are linked through NextIconOwner
+	TMap<FName, FSlateIconId> IconOwnerIndex;
+	// next icon with the same name registered in another style set
+	TArray<FSlateIconId> NextIconOwner;
+	// descriptor views handed out to widgets
+	TMap<FSlateIconId, TWeakPtr<FSlateIconDescriptor>> IconViews;
+	int32 NextIconViewPrune = 0;
+	// interned descriptors for names missing from catalog, handed out by FindStyleSet and FindIcon
+	TMap<FName, TSharedPtr<FSlateStyleSetDescriptor>> UnknownStyleSets;
+	TMap<TPair<FName, FName>, TSharedPtr<FSlateIconDescriptor>> UnknownIcons;
 };
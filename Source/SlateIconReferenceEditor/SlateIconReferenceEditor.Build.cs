@@ -35,7 +35,8 @@ public class SlateIconReferenceEditor : ModuleRules
             "EditorStyle",
             "EditorWidgets",
             "InputCore",
-            "ApplicationCore"
+            "ApplicationCore",
+            "AssetRegistry"
         });
 
         if (Target.Version.MajorVersion == 4 && CppStandard < CppStandardVersion.Cpp17)
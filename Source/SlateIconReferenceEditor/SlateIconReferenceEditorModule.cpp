@@ -13,6 +13,12 @@
 
 IMPLEMENT_MODULE(FSlateIconReferenceEditorModule, SlateIconReferenceEditor);
 
+namespace Switches
+{
+	// seconds between checks for style sets modified after registration, zero disables
+	constexpr float StyleChangePollInterval = 2.0f;
+}
+
 void FSlateIconReferenceEditorModule::StartupModule()
 {
 	if (GIsEditor && !IsRunningCommandlet())
@@ -21,6 +27,15 @@ void FSlateIconReferenceEditorModule::StartupModule()
 
 		FModuleManager::Get().OnModulesChanged().AddRaw(this, &FSlateIconReferenceEditorModule::HandleModulesChanged);
 
+		if (Switches::StyleChangePollInterval > 0.f)
+		{
+#if UE_VERSION_OLDER_THAN(5, 0, 0)
+			PollTickHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FSlateIconReferenceEditorModule::HandleStyleChangePoll), Switches::StyleChangePollInterval);
+#else
+			PollTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FSlateIconReferenceEditorModule::HandleStyleChangePoll), Switches::StyleChangePollInterval);
+#endif
+		}
+
 		FPropertyEditorModule& PropertyEditor = FModuleManager::Get().GetModuleChecked<FPropertyEditorModule>("PropertyEditor");
 		PropertyEditor.RegisterCustomPropertyTypeLayout(FSlateIconRefTypeCustomization::TypeName,
 			FOnGetPropertyTypeCustomizationInstance::CreateStatic(&FSlateIconRefTypeCustomization::MakeInstance)
@@ -35,7 +50,28 @@ void FSlateIconReferenceEditorModule::ShutdownModule()
 		StyleSet.Reset();
 
 		FModuleManager::Get().OnModulesChanged().RemoveAll(this);
+
+		if (RescanTickHandle.IsValid())
+		{
+#if UE_VERSION_OLDER_THAN(5, 0, 0)
+			FTicker::GetCoreTicker().RemoveTicker(RescanTickHandle);
+#else
+			FTSTicker::GetCoreTicker().RemoveTicker(RescanTickHandle);
+#endif
+			RescanTickHandle.Reset();
+		}
+
+		if (PollTickHandle.IsValid())
+		{
+#if UE_VERSION_OLDER_THAN(5, 0, 0)
+			FTicker::GetCoreTicker().RemoveTicker(PollTickHandle);
+#else
+			FTSTicker::GetCoreTicker().RemoveTicker(PollTickHandle);
+#endif
+			PollTickHandle.Reset();
+		}
 		
+		FSlateIconRefDataHelper::GetDataSource().FlushCache();
 		FSlateIconRefDataHelper::GetDataSource().ClearStyleData();
 
 		if (FModuleManager::Get().IsModuleLoaded("PropertyEditor") )
@@ -54,9 +90,16 @@ void FSlateIconReferenceEditorModule::HandleModulesChanged(FName Name, EModuleCh
 		{
 		case EModuleChangeReason::ModuleLoaded:
 		case EModuleChangeReason::ModuleUnloaded:
-			// clear known style data in order to re-initialize later
-			FSlateIconRefDataHelper::GetDataSource().ForceRescan();
-			FSlateIconRefDataHelper::GetDataSource().ClearStyleData();
+			// style sets come and go with owning modules, update known style data once the burst settles
+			FSlateIconRefDataHelper::GetDataSource().RequestRescan();
+			if (!RescanTickHandle.IsValid())
+			{
+#if UE_VERSION_OLDER_THAN(5, 0, 0)
+				RescanTickHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FSlateIconReferenceEditorModule::HandleDeferredRescan));
+#else
+				RescanTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FSlateIconReferenceEditorModule::HandleDeferredRescan));
+#endif
+			}
 			break;
 		default:
 		case EModuleChangeReason::PluginDirectoryChanged:
@@ -65,6 +108,31 @@ void FSlateIconReferenceEditorModule::HandleModulesChanged(FName Name, EModuleCh
 	}
 }
 
+bool FSlateIconReferenceEditorModule::HandleDeferredRescan(float DeltaTime)
+{
+	RescanTickHandle.Reset();
+
+	// catalog that was never built is left to lazy setup
+	FSlateIconRefDataHelper& DataSource = FSlateIconRefDataHelper::GetDataSource();
+	if (DataSource.bInitialized)
+	{
+		DataSource.SetupStyleData();
+	}
+	return false;
+}
+
+bool FSlateIconReferenceEditorModule::HandleStyleChangePoll(float DeltaTime)
+{
+	// style sets modified after registration do not raise any event, changed ones are rescanned incrementally
+	FSlateIconRefDataHelper& DataSource = FSlateIconRefDataHelper::GetDataSource();
+	if (!RescanTickHandle.IsValid() && DataSource.DetectChangedStyleSets())
+	{
+		DataSource.RequestRescan();
+		DataSource.SetupStyleData();
+	}
+	return true;
+}
+
 #undef LOCTEXT_NAMESPACE
 
 
@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include "Containers/Ticker.h"
+#include "Misc/EngineVersionComparison.h"
 #include "Modules/ModuleInterface.h"
 #include "Modules/ModuleManager.h"
 
@@ -14,6 +16,20 @@ public:
     virtual void ShutdownModule() override;
 
     void HandleModulesChanged(FName Name, EModuleChangeReason ModuleChangeReason);
+    bool HandleDeferredRescan(float DeltaTime);
+    bool HandleStyleChangePoll(float DeltaTime);
 private:
     TSharedPtr<FSlateIconReferenceEditorStyle> StyleSet;
+    // pending catalog update, module events within one frame share it
+#if UE_VERSION_OLDER_THAN(5, 0, 0)
+    FDelegateHandle RescanTickHandle;
+#else
+    FTSTicker::FDelegateHandle RescanTickHandle;
+#endif
+    // periodic check for brushes added to registered style sets
+#if UE_VERSION_OLDER_THAN(5, 0, 0)
+    FDelegateHandle PollTickHandle;
+#else
+    FTSTicker::FDelegateHandle PollTickHandle;
+#endif
 };
@@ -0,0 +1,608 @@
+﻿// Copyright 2025, Aquanox.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "SlateIconReferenceTestHelpers.h"
+#include "Internal/SlateIconRefDataHelper.h"
+#include "Internal/SlateIconNameFilter.h"
+#include "SlateStyleSetAccess.h"
+#include "Brushes/SlateImageBrush.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/Paths.h"
+
+namespace SlateIconCatalogTests
+{
+	using namespace SlateIconReferenceTests;
+
+	// roughly the size of an editor with many plugins enabled
+	constexpr int32 NumBenchmarkStyles = 200;
+	constexpr int32 NumBenchmarkIconsPerStyle = 250;
+
+	/**
+	 * Style sets registered for the duration of a benchmark
+	 */
+	struct FScopedBenchmarkStyles
+	{
+		TArray<TUniquePtr<FScopedTestStyle>> Styles;
+
+		FScopedBenchmarkStyles(int32 NumStyles, int32 NumIconsPerStyle)
+		{
+			for (int32 Index = 0; Index < NumStyles; ++Index)
+			{
+				Styles.Add(MakeUnique<FScopedTestStyle>(FName(TEXT("SlateIconCatalogTests"), Index + 1), NumIconsPerStyle));
+			}
+		}
+
+		FName GetName(int32 Index) const { return Styles[Index]->GetName(); }
+	};
+
+#if !UE_VERSION_OLDER_THAN(5,0,0)
+	/**
+	 * Chain of style sets each deriving from the previous one, every level registers its own icons
+	 */
+	struct FScopedStyleChain
+	{
+		TArray<TSharedRef<FSlateStyleSet>> Styles;
+
+		FScopedStyleChain(int32 Depth, int32 NumIconsPerStyle)
+		{
+			for (int32 Level = 0; Level < Depth; ++Level)
+			{
+				TSharedRef<FSlateStyleSet> Style = MakeShared<FSlateStyleSet>(FName(TEXT("SlateIconCatalogTests.Chain"), Level + 1));
+				if (Level > 0)
+				{
+					Style->SetParentStyleName(Styles.Last()->GetStyleSetName());
+				}
+				for (int32 Index = 0; Index < NumIconsPerStyle; ++Index)
+				{
+					Style->Set(GetIconName(Level, Index), new FSlateColorBrush(FLinearColor::White));
+				}
+				FSlateStyleRegistry::RegisterSlateStyle(*Style);
+				Styles.Add(Style);
+			}
+		}
+
+		~FScopedStyleChain()
+		{
+			for (const TSharedRef<FSlateStyleSet>& Style : Styles)
+			{
+				FSlateStyleRegistry::UnRegisterSlateStyle(*Style);
+			}
+		}
+
+		static FName GetIconName(int32 Level, int32 Index) { return FName(*FString::Printf(TEXT("Chain%d.Icon"), Level), Index + 1); }
+		FName GetName(int32 Level) const { return Styles[Level]->GetStyleSetName(); }
+		FName GetLeafName() const { return Styles.Last()->GetStyleSetName(); }
+	};
+#endif
+
+	/**
+	 * Collects lines printed by catalog diagnostics
+	 */
+	struct FLineCollector : public FOutputDevice
+	{
+		TArray<FString> Lines;
+
+		virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category) override
+		{
+			Lines.Add(V);
+		}
+	};
+
+	// publish pending work so the catalog matches the registry on return
+	static void FinishBuilds(FSlateIconRefDataHelper& DataSource)
+	{
+		DataSource.SetupStyleData();
+		while (DataSource.IsBuildInProgress())
+		{
+			DataSource.FinishBuild();
+		}
+	}
+
+	static void RebuildCatalog(FSlateIconRefDataHelper& DataSource)
+	{
+		DataSource.ForceRescan(true);
+		FinishBuilds(DataSource);
+	}
+
+	static const FSlateStyleSetDescriptor* FindKnownStyleSet(const FSlateIconRefDataHelper& DataSource, FName StyleSetName)
+	{
+		const TSharedPtr<FSlateStyleSetDescriptor>* Found = DataSource.GetStyleSets().FindByPredicate([StyleSetName](const TSharedPtr<FSlateStyleSetDescriptor>& StyleSet) { return StyleSet->Name == StyleSetName; });
+		return Found ? Found->Get() : nullptr;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSlateIconCatalogBuildBenchmark, "SlateIconReference.Benchmark.CatalogBuild", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FSlateIconCatalogBuildBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace SlateIconCatalogTests;
+
+	constexpr int32 NumPasses = 5;
+
+	FSlateIconRefDataHelper& DataSource = FSlateIconRefDataHelper::GetDataSource();
+	{
+		FScopedBenchmarkStyles BenchmarkStyles(NumBenchmarkStyles, NumBenchmarkIconsPerStyle);
+
+		// measures the build filling every style set
+		FScopedConsoleVariable LazyCatalog(TEXT("SlateIconReference.LazyCatalog"), TEXT("0"));
+
+		for (const TCHAR* ParallelValue : { TEXT("0"), TEXT("1") })
+		{
+			FScopedConsoleVariable ParallelBuild(TEXT("SlateIconReference.ParallelCatalogBuild"), ParallelValue);
+
+			// best of several full rebuilds, disk cache is bypassed
+			FSlateIconCatalogBuildStats Best;
+			Best.BuildSeconds = MAX_dbl;
+			for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+			{
+				RebuildCatalog(DataSource);
+
+				const FSlateIconCatalogBuildStats& Stats = DataSource.GetLastBuildStats();
+				if (Stats.BuildSeconds < Best.BuildSeconds)
+				{
+					Best = Stats;
+				}
+			}
+
+			TestTrue(TEXT("Catalog holds benchmark icons"), Best.NumIcons >= NumBenchmarkStyles * NumBenchmarkIconsPerStyle);
+			AddInfo(FString::Printf(TEXT("%s build of %d style sets, %d icons: snapshot %.2f ms, build %.2f ms, publish %.2f ms"),
+				Best.bParallel ? TEXT("Parallel") : TEXT("Serial"), Best.NumStyleSets, Best.NumIcons,
+				Best.SnapshotSeconds * 1000.0, Best.BuildSeconds * 1000.0, Best.PublishSeconds * 1000.0));
+		}
+	}
+
+	DataSource.RequestRescan();
+	FinishBuilds(DataSource);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSlateIconCatalogLookupTest, "SlateIconReference.Catalog.Lookup", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSlateIconCatalogLookupTest::RunTest(const FString& Parameters)
+{
+	using namespace SlateIconCatalogTests;
+
+	FSlateIconRefDataHelper& DataSource = FSlateIconRefDataHelper::GetDataSource();
+	{
+		FScopedTestStyle TestStyle(TEXT("SlateIconCatalogTests.Lookup"), 8);
+		DataSource.RequestRescan();
+		FinishBuilds(DataSource);
+
+		TSharedPtr<FSlateStyleSetDescriptor> StyleSet = DataSource.FindStyleSet(TestStyle.GetName());
+		TestTrue(TEXT("Registered style set is known"), StyleSet.IsValid() && !StyleSet->IsUnknown());
+
+		TSharedPtr<FSlateIconDescriptor> Icon = DataSource.FindIcon(TestStyle.GetName(), FName(TEXT("Test.Extra"), 8));
+		TestTrue(TEXT("Registered icon is known"), Icon.IsValid() && !Icon->IsUnknown() && Icon->Id != InvalidSlateIconId);
+		TestTrue(TEXT("Registered icons are listed"), StyleSet->GetNumRegisteredIcons() > 0);
+		TestTrue(TEXT("Registered icon resolves its brush"), Icon->GetBrush() == TestStyle.Style->GetBrush(FName(TEXT("Test.Extra"), 8)));
+		TestTrue(TEXT("Repeated lookup shares view"), DataSource.FindIcon(TestStyle.GetName(), FName(TEXT("Test.Extra"), 8)) == Icon);
+
+		TestTrue(TEXT("Missing icon is unknown"), DataSource.FindIcon(TestStyle.GetName(), TEXT("Test.Missing"))->IsUnknown());
+		TestTrue(TEXT("Missing style set is unknown"), DataSource.FindStyleSet(TEXT("SlateIconCatalogTests.Missing"))->IsUnknown());
+		TestTrue(TEXT("Missing icon is not made on request"), DataSource.FindIcon(TestStyle.GetName(), TEXT("Test.Missing"), false)->IsNone());
+	}
+
+	DataSource.RequestRescan();
+	FinishBuilds(DataSource);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSlateIconCatalogLazyBuildTest, "SlateIconReference.Catalog.LazyBuild", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSlateIconCatalogLazyBuildTest::RunTest(const FString& Parameters)
+{
+	using namespace SlateIconCatalogTests;
+
+	const FName IconName(TEXT("Test.Extra"), 4);
+
+	FSlateIconRefDataHelper& DataSource = FSlateIconRefDataHelper::GetDataSource();
+	{
+		FScopedTestStyle TestStyle(TEXT("SlateIconCatalogTests.Lazy"), 8);
+		{
+			FScopedConsoleVariable LazyCatalog(TEXT("SlateIconReference.LazyCatalog"), TEXT("1"));
+			RebuildCatalog(DataSource);
+
+			TSharedPtr<FSlateStyleSetDescriptor> StyleSet = DataSource.FindStyleSet(TestStyle.GetName());
+			TestTrue(TEXT("Lazy build records style set"), !StyleSet->IsUnknown());
+			TestTrue(TEXT("Lazy build leaves style set empty"), !StyleSet->bMaterialized && StyleSet->GetNumRegisteredIcons() == 0);
+
+			TestFalse(TEXT("Lookup finds icon of lazy style set"), DataSource.FindIcon(TestStyle.GetName(), IconName)->IsUnknown());
+			TestTrue(TEXT("Lookup materializes style set"), StyleSet->bMaterialized && StyleSet->GetNumRegisteredIcons() > 0);
+		}
+
+		{
+			FScopedConsoleVariable LazyCatalog(TEXT("SlateIconReference.LazyCatalog"), TEXT("1"));
+			RebuildCatalog(DataSource);
+
+			// another set triggers a build that snapshots the test set before it is materialized
+			FScopedTestStyle OtherStyle(TEXT("SlateIconCatalogTests.Lazy.Other"));
+			DataSource.RequestRescan();
+			DataSource.SetupStyleData();
+			TestTrue(TEXT("Build is in progress"), DataSource.IsBuildInProgress());
+
+			TSharedPtr<FSlateIconDescriptor> Icon = DataSource.FindIcon(TestStyle.GetName(), IconName);
+			TestTrue(TEXT("Icon is found while building"), !Icon->IsUnknown() && Icon->Id != InvalidSlateIconId);
+			const int32 NumMaterializedIcons = DataSource.FindStyleSet(TestStyle.GetName())->GetNumRegisteredIcons();
+
+			FinishBuilds(DataSource);
+
+			TSharedPtr<FSlateStyleSetDescriptor> StyleSet = DataSource.FindStyleSet(TestStyle.GetName());
+			TestTrue(TEXT("Style set materialized while building stays materialized"), StyleSet->bMaterialized && StyleSet->GetNumRegisteredIcons() == NumMaterializedIcons);
+			TestTrue(TEXT("View made while building is remapped"), Icon->Id != InvalidSlateIconId && DataSource.GetIconName(Icon->Id) == IconName);
+			TestTrue(TEXT("Lookup after publish shares view"), DataSource.FindIcon(TestStyle.GetName(), IconName) == Icon);
+			TestEqual(TEXT("Carried icon is owned by its style set"), DataSource.FindRegisteredIcon(*StyleSet, IconName), Icon->Id);
+		}
+
+		{
+			FScopedConsoleVariable LazyCatalog(TEXT("SlateIconReference.LazyCatalog"), TEXT("0"));
+			RebuildCatalog(DataSource);
+
+			TSharedPtr<FSlateStyleSetDescriptor> StyleSet = DataSource.FindStyleSet(TestStyle.GetName());
+			TestTrue(TEXT("Eager build fills style set"), StyleSet->bMaterialized && StyleSet->GetNumRegisteredIcons() > 0);
+			TestFalse(TEXT("Eager build fills every style set"), DataSource.GetStyleSets().ContainsByPredicate([](const TSharedPtr<FSlateStyleSetDescriptor>& Descriptor) { return !Descriptor->bMaterialized; }));
+		}
+	}
+
+	DataSource.RequestRescan();
+	FinishBuilds(DataSource);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSlateIconCatalogCacheTest, "SlateIconReference.Catalog.DiskCache", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSlateIconCatalogCacheTest::RunTest(const FString& Parameters)
+{
+	using namespace SlateIconCatalogTests;
+
+	const FString CacheFilePath = FPaths::CreateTempFilename(*FPaths::ProjectIntermediateDir(), TEXT("SlateIconCatalogTests"), TEXT(".bin"));
+	const FName StyleSetName = TEXT("SlateIconCatalogTests.Cache");
+	const FName ReplacedIconName(TEXT("Test.Extra"), 1);
+
+	FSlateIconRefDataHelper& DataSource = FSlateIconRefDataHelper::GetDataSource();
+	{
+		TUniquePtr<FScopedTestStyle> TestStyle = MakeUnique<FScopedTestStyle>(StyleSetName, 4);
+		DataSource.RequestRescan();
+		FinishBuilds(DataSource);
+		DataSource.FindIcon(StyleSetName, ReplacedIconName);
+
+		const uint32 Fingerprint = DataSource.ComputeRegistryFingerprint();
+		TestTrue(TEXT("Cache written"), DataSource.SaveCache(CacheFilePath, Fingerprint));
+
+		FSlateIconRefDataHelper Loaded;
+		TestFalse(TEXT("Cache of other registry is rejected"), Loaded.LoadCache(CacheFilePath, Fingerprint + 1));
+		TestTrue(TEXT("Cache read back"), Loaded.LoadCache(CacheFilePath, Fingerprint));
+		TestEqual(TEXT("Style sets read back"), Loaded.GetStyleSets().Num(), DataSource.GetStyleSets().Num());
+		TestEqual(TEXT("Icons read back"), Loaded.GetNumIcons(), DataSource.GetNumIcons());
+
+		for (int32 Index = 0; Index < DataSource.GetStyleSets().Num() && Index < Loaded.GetStyleSets().Num(); ++Index)
+		{
+			const FSlateStyleSetDescriptor& Saved = *DataSource.GetStyleSets()[Index];
+			const FSlateStyleSetDescriptor& Read = *Loaded.GetStyleSets()[Index];
+			const FString Context = Saved.Name.ToString();
+			TestEqual(*(Context + TEXT(" name")), Read.Name, Saved.Name);
+			TestEqual(*(Context + TEXT(" parent")), Read.ParentStyleName, Saved.ParentStyleName);
+			TestEqual(*(Context + TEXT(" brush count")), Read.NumBrushes, Saved.NumBrushes);
+			TestEqual(*(Context + TEXT(" brush hash")), Read.BrushHash, Saved.BrushHash);
+			TestEqual(*(Context + TEXT(" materialized")), Read.bMaterialized, Saved.bMaterialized);
+			TestEqual(*(Context + TEXT(" icon count")), Read.NumIcons, Saved.NumIcons);
+
+			// saved ranges may be out of style set order, compare by offset within each set
+			for (int32 Offset = 0; Offset < Saved.NumIcons && Offset < Read.NumIcons; ++Offset)
+			{
+				const FSlateIconId SavedId = Saved.FirstIcon + Offset;
+				const FSlateIconId ReadId = Read.FirstIcon + Offset;
+				const FSlateIconBrushInfo& SavedInfo = DataSource.GetIconBrushInfo(SavedId);
+				const FSlateIconBrushInfo& ReadInfo = Loaded.GetIconBrushInfo(ReadId);
+				const bool bSame = Loaded.GetIconName(ReadId) == DataSource.GetIconName(SavedId)
+					&& Loaded.GetIconFlags(ReadId) == DataSource.GetIconFlags(SavedId)
+					&& ReadInfo.ResourceName == SavedInfo.ResourceName
+					&& ReadInfo.ImageWidth == SavedInfo.ImageWidth && ReadInfo.ImageHeight == SavedInfo.ImageHeight
+					&& ReadInfo.DrawType == SavedInfo.DrawType && ReadInfo.ImageType == SavedInfo.ImageType && ReadInfo.Tiling == SavedInfo.Tiling;
+				if (!bSame)
+				{
+					AddError(FString::Printf(TEXT("%s icon %d read back differently"), *Context, Offset));
+					break;
+				}
+			}
+		}
+
+		const FSlateStyleSetDescriptor* SavedStyleSet = FindKnownStyleSet(DataSource, StyleSetName);
+		const int32 NumTestIcons = SavedStyleSet ? SavedStyleSet->NumIcons : 0;
+		TestTrue(TEXT("Test style set was cached with its icons"), SavedStyleSet && SavedStyleSet->bMaterialized && NumTestIcons > 0);
+
+		// next session registers same names and brush count, one brush is replaced
+		TSharedRef<FSlateStyleSet> ReplacedStyle = MakeShared<FSlateStyleSet>(StyleSetName);
+		for (const auto& KeyToBrush : FSlateStyleSetAccess::GetBrushResources(*TestStyle->Style))
+		{
+			if (KeyToBrush.Key == ReplacedIconName)
+			{
+				ReplacedStyle->Set(KeyToBrush.Key, new FSlateImageBrush(FName(TEXT("SlateIconCatalogTests.Replaced")), FVector2D(24.f, 24.f)));
+			}
+			else
+			{
+				ReplacedStyle->Set(KeyToBrush.Key, new FSlateColorBrush(FLinearColor::White));
+			}
+		}
+		TestStyle.Reset();
+		FSlateStyleRegistry::RegisterSlateStyle(*ReplacedStyle);
+
+		TestEqual(TEXT("Fingerprint does not see replaced brush"), DataSource.ComputeRegistryFingerprint(), Fingerprint);
+
+		FSlateIconRefDataHelper Reloaded;
+		TestTrue(TEXT("Cache read back after brush was replaced"), Reloaded.LoadCache(CacheFilePath, Fingerprint));
+		const FSlateStyleSetDescriptor* ReloadedStyleSet = FindKnownStyleSet(Reloaded, StyleSetName);
+		TestTrue(TEXT("Changed style set is left for scan"), ReloadedStyleSet && !ReloadedStyleSet->bMaterialized && ReloadedStyleSet->NumIcons == 0);
+		TestEqual(TEXT("Other style sets are kept"), Reloaded.GetNumIcons(), Loaded.GetNumIcons() - NumTestIcons);
+
+		FSlateStyleRegistry::UnRegisterSlateStyle(*ReplacedStyle);
+	}
+
+	IFileManager::Get().Delete(*CacheFilePath);
+
+	DataSource.RequestRescan();
+	FinishBuilds(DataSource);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSlateIconNameFilterTest, "SlateIconReference.Catalog.NameFilter", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSlateIconNameFilterTest::RunTest(const FString& Parameters)
+{
+	FSlateIconNameFilter Filter;
+	Filter.Compile({ TEXT("Icons.*") }, { TEXT("*.Hovered"), TEXT("Debug.*"), TEXT("Icons.?ressed") });
+
+	TestTrue(TEXT("Included name passes"), Filter.PassesFilter(TEXT("Icons.Help")));
+	TestFalse(TEXT("Name outside include rules is rejected"), Filter.PassesFilter(TEXT("Other.Help")));
+	TestFalse(TEXT("Suffix exclusion applies"), Filter.PassesFilter(TEXT("Icons.Help.Hovered")));
+	TestFalse(TEXT("Wildcard exclusion applies"), Filter.PassesFilter(TEXT("Icons.Pressed")));
+
+	FSlateIconNameFilter Reordered;
+	Reordered.Compile({ TEXT(" icons.* ") }, { TEXT("Icons.?ressed"), TEXT("Debug.*"), TEXT("*.Hovered"), TEXT("Debug.*") });
+	TestEqual(TEXT("Rules hash ignores order, case and repeats"), Reordered.GetRulesHash(), Filter.GetRulesHash());
+
+	FSlateIconNameFilter Swapped;
+	Swapped.Compile({ TEXT("*.Hovered"), TEXT("Debug.*"), TEXT("Icons.?ressed") }, { TEXT("Icons.*") });
+	TestNotEqual(TEXT("Rules hash tells include from exclude"), Swapped.GetRulesHash(), Filter.GetRulesHash());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSlateIconCatalogLookupBenchmark, "SlateIconReference.Benchmark.CatalogLookup", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FSlateIconCatalogLookupBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace SlateIconCatalogTests;
+
+	constexpr int32 NumPasses = 8;
+	constexpr int32 NumLookupsPerStyle = 16;
+
+	FSlateIconRefDataHelper& DataSource = FSlateIconRefDataHelper::GetDataSource();
+	{
+		FScopedBenchmarkStyles BenchmarkStyles(NumBenchmarkStyles, NumBenchmarkIconsPerStyle);
+		DataSource.RequestRescan();
+		FinishBuilds(DataSource);
+
+		TArray<TPair<FName, FName>> Keys;
+		for (int32 StyleIndex = 0; StyleIndex < NumBenchmarkStyles; ++StyleIndex)
+		{
+			for (int32 Index = 0; Index < NumLookupsPerStyle; ++Index)
+			{
+				Keys.Emplace(BenchmarkStyles.GetName(StyleIndex), FName(TEXT("Test.Extra"), 1 + (Index * 7919 + StyleIndex) % NumBenchmarkIconsPerStyle));
+			}
+		}
+
+		// results are held like widgets hold them, so views are made once
+		TArray<TSharedPtr<FSlateStyleSetDescriptor>> StyleSets;
+		TArray<TSharedPtr<FSlateIconDescriptor>> Icons;
+		StyleSets.SetNum(Keys.Num());
+		Icons.SetNum(Keys.Num());
+
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+		{
+			for (int32 Index = 0; Index < Keys.Num(); ++Index)
+			{
+				StyleSets[Index] = DataSource.FindStyleSet(Keys[Index].Key);
+			}
+		}
+		const double StyleSetTime = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+		{
+			for (int32 Index = 0; Index < Keys.Num(); ++Index)
+			{
+				Icons[Index] = DataSource.FindIcon(Keys[Index].Key, Keys[Index].Value);
+			}
+		}
+		const double IconTime = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+		{
+			for (int32 Index = 0; Index < Keys.Num(); ++Index)
+			{
+				Icons[Index] = DataSource.FindIcon(Keys[Index].Key, TEXT("Test.Missing"), false);
+			}
+		}
+		const double MissTime = FPlatformTime::Seconds() - StartTime;
+
+		const int32 NumLookups = Keys.Num() * NumPasses;
+		AddInfo(FString::Printf(TEXT("%d style sets, %d icons"), DataSource.GetStyleSets().Num(), DataSource.GetNumIcons()));
+		AddInfo(FString::Printf(TEXT("FindStyleSet: %.3f us per lookup"), SecondsToMicroseconds(StyleSetTime) / NumLookups));
+		AddInfo(FString::Printf(TEXT("FindIcon: %.3f us per lookup"), SecondsToMicroseconds(IconTime) / NumLookups));
+		AddInfo(FString::Printf(TEXT("FindIcon missing: %.3f us per lookup"), SecondsToMicroseconds(MissTime) / NumLookups));
+	}
+
+	DataSource.RequestRescan();
+	FinishBuilds(DataSource);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSlateIconCatalogMemoryBenchmark, "SlateIconReference.Benchmark.CatalogMemory", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FSlateIconCatalogMemoryBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace SlateIconCatalogTests;
+
+	FSlateIconRefDataHelper& DataSource = FSlateIconRefDataHelper::GetDataSource();
+	{
+		FScopedBenchmarkStyles BenchmarkStyles(NumBenchmarkStyles, NumBenchmarkIconsPerStyle);
+		DataSource.RequestRescan();
+		FinishBuilds(DataSource);
+
+		// pickers list ids and make views only for what passes their filters
+		TArray<FSlateIconId> Ids;
+		for (int32 StyleIndex = 0; StyleIndex < NumBenchmarkStyles; ++StyleIndex)
+		{
+			DataSource.GatherIconIds(BenchmarkStyles.GetName(StyleIndex), false, Ids);
+		}
+
+		FLineCollector IdsReport;
+		DataSource.DumpMemoryStats(IdsReport);
+		const SIZE_T IdsMemory = DataSource.GetAllocatedSize();
+
+		// same icons with a shared view each, as if every one of them was listed at once
+		TArray<TSharedPtr<FSlateIconDescriptor>> Views;
+		for (int32 StyleIndex = 0; StyleIndex < NumBenchmarkStyles; ++StyleIndex)
+		{
+			DataSource.GatherIconData(false, BenchmarkStyles.GetName(StyleIndex), false, Views);
+		}
+
+		FLineCollector ViewsReport;
+		DataSource.DumpMemoryStats(ViewsReport);
+		const SIZE_T ViewsMemory = DataSource.GetAllocatedSize();
+
+		TestEqual(TEXT("Every gathered id has a view"), Views.Num(), Ids.Num());
+
+		AddInfo(FString::Printf(TEXT("%d icons gathered: %llu bytes with ids only, %llu bytes with a view each (%.1f bytes per view)"),
+			Ids.Num(), (uint64)IdsMemory, (uint64)ViewsMemory, Ids.Num() ? double(ViewsMemory - IdsMemory) / Ids.Num() : 0.0));
+		for (const FString& Line : IdsReport.Lines)
+		{
+			AddInfo(TEXT("Ids only: ") + Line);
+		}
+		for (const FString& Line : ViewsReport.Lines)
+		{
+			AddInfo(TEXT("With views: ") + Line);
+		}
+	}
+
+	DataSource.RequestRescan();
+	FinishBuilds(DataSource);
+	return true;
+}
+
+#if !UE_VERSION_OLDER_THAN(5,0,0)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSlateIconCatalogInheritanceTest, "SlateIconReference.Catalog.Inheritance", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSlateIconCatalogInheritanceTest::RunTest(const FString& Parameters)
+{
+	using namespace SlateIconCatalogTests;
+
+	FSlateIconRefDataHelper& DataSource = FSlateIconRefDataHelper::GetDataSource();
+	{
+		FScopedStyleChain Chain(3, 4);
+		// leaf overrides one of the root icons
+		Chain.Styles.Last()->Set(FScopedStyleChain::GetIconName(0, 0), new FSlateColorBrush(FLinearColor::Black));
+		DataSource.RequestRescan();
+		FinishBuilds(DataSource);
+
+		TSharedPtr<FSlateIconDescriptor> Inherited = DataSource.FindIcon(Chain.GetLeafName(), FScopedStyleChain::GetIconName(0, 1));
+		TestTrue(TEXT("Root icon is visible from leaf"), !Inherited->IsUnknown());
+		TestEqual(TEXT("Root icon is owned by root"), Inherited->StyleSetName, Chain.GetName(0));
+
+		TSharedPtr<FSlateIconDescriptor> Overridden = DataSource.FindIcon(Chain.GetLeafName(), FScopedStyleChain::GetIconName(0, 0));
+		TestEqual(TEXT("Own icon takes precedence"), Overridden->StyleSetName, Chain.GetLeafName());
+
+		TestTrue(TEXT("Leaf icon is not visible from root"), DataSource.FindIcon(Chain.GetName(0), FScopedStyleChain::GetIconName(2, 0))->IsUnknown());
+
+		TArray<TSharedPtr<FSlateIconDescriptor>> Icons;
+		DataSource.GatherIconData(false, Chain.GetLeafName(), true, Icons);
+		TestTrue(TEXT("Inherited list holds icons of every level"), Icons.Num() >= 3 * 4);
+
+		const TSharedPtr<FSlateIconDescriptor>* FirstOverridden = Icons.FindByPredicate([](const TSharedPtr<FSlateIconDescriptor>& Icon) { return Icon->Name == FScopedStyleChain::GetIconName(0, 0); });
+		TestTrue(TEXT("Inherited list puts own icon first"), FirstOverridden && (*FirstOverridden)->StyleSetName == Chain.GetLeafName());
+	}
+
+	DataSource.RequestRescan();
+	FinishBuilds(DataSource);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSlateIconCatalogInheritedLookupBenchmark, "SlateIconReference.Benchmark.InheritedLookup", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FSlateIconCatalogInheritedLookupBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace SlateIconCatalogTests;
+
+	constexpr int32 Depth = 8;
+	constexpr int32 NumIconsPerStyle = 250;
+	constexpr int32 NumPasses = 32;
+
+	FSlateIconRefDataHelper& DataSource = FSlateIconRefDataHelper::GetDataSource();
+	{
+		DataSource.RequestRescan();
+		FinishBuilds(DataSource);
+		const SIZE_T MemoryBefore = DataSource.GetAllocatedSize();
+
+		FScopedStyleChain Chain(Depth, NumIconsPerStyle);
+		DataSource.RequestRescan();
+		FinishBuilds(DataSource);
+		const SIZE_T MemoryWithChain = DataSource.GetAllocatedSize();
+
+		TArray<TSharedPtr<FSlateIconDescriptor>> Held;
+		Held.SetNum(NumIconsPerStyle);
+
+		// lookups from the leaf for icons owned Distance levels up the chain
+		for (int32 Distance = 0; Distance < Depth; ++Distance)
+		{
+			const int32 OwnerLevel = Depth - 1 - Distance;
+
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+			{
+				for (int32 Index = 0; Index < NumIconsPerStyle; ++Index)
+				{
+					Held[Index] = DataSource.FindIcon(Chain.GetLeafName(), FScopedStyleChain::GetIconName(OwnerLevel, Index));
+				}
+			}
+			const double LookupTime = FPlatformTime::Seconds() - StartTime;
+
+			TestEqual(*FString::Printf(TEXT("Icon %d levels up resolves to its owner"), Distance), Held[0]->StyleSetName, Chain.GetName(OwnerLevel));
+			AddInfo(FString::Printf(TEXT("FindIcon %d levels up: %.3f us per lookup"), Distance, SecondsToMicroseconds(LookupTime) / (NumPasses * NumIconsPerStyle)));
+		}
+
+		Held.Reset();
+
+		TArray<TSharedPtr<FSlateIconDescriptor>> Icons;
+		const double StartTime = FPlatformTime::Seconds();
+		DataSource.GatherIconData(false, Chain.GetLeafName(), true, Icons);
+		const double GatherTime = FPlatformTime::Seconds() - StartTime;
+		const SIZE_T MemoryWithInherited = DataSource.GetAllocatedSize();
+
+		// every level sees its own icons and all of its ancestors
+		int32 NumReachablePairs = 0;
+		for (int32 Level = 0; Level < Depth; ++Level)
+		{
+			NumReachablePairs += (Level + 1) * NumIconsPerStyle;
+		}
+
+		AddInfo(FString::Printf(TEXT("Chain of %d style sets, %d icons each, %d reachable style set and icon pairs"), Depth, NumIconsPerStyle, NumReachablePairs));
+		AddInfo(FString::Printf(TEXT("Catalog memory: %llu bytes before, %llu bytes with chain, %llu bytes with inherited list of leaf"),
+			(uint64)MemoryBefore, (uint64)MemoryWithChain, (uint64)MemoryWithInherited));
+		AddInfo(FString::Printf(TEXT("Inherited list of leaf: %d icons gathered in %.3f ms"), Icons.Num(), GatherTime * 1000.0));
+	}
+
+	DataSource.RequestRescan();
+	FinishBuilds(DataSource);
+	return true;
+}
+
+#endif
+
+#endif
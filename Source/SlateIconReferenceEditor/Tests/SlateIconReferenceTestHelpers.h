@@ -0,0 +1,70 @@
+﻿// Copyright 2025, Aquanox.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Brushes/SlateColorBrush.h"
+#include "HAL/IConsoleManager.h"
+#include "Styling/SlateStyle.h"
+#include "Styling/SlateStyleRegistry.h"
+
+namespace SlateIconReferenceTests
+{
+	/**
+	 * Style set registered for the duration of a test
+	 */
+	struct FScopedTestStyle
+	{
+		TSharedRef<FSlateStyleSet> Style;
+
+		explicit FScopedTestStyle(FName InName = TEXT("SlateIconReferenceTests"), int32 NumExtraIcons = 0)
+			: Style(MakeShared<FSlateStyleSet>(InName))
+		{
+			Style->Set(TEXT("Test.Icon"), new FSlateColorBrush(FLinearColor::White));
+			Style->Set(TEXT("Test.Icon.Small"), new FSlateColorBrush(FLinearColor::Gray));
+			Style->Set(TEXT("Test.Other"), new FSlateColorBrush(FLinearColor::Red));
+			Style->Set(TEXT("Test.Overlay"), new FSlateColorBrush(FLinearColor::Green));
+			for (int32 Index = 0; Index < NumExtraIcons; ++Index)
+			{
+				Style->Set(FName(TEXT("Test.Extra"), Index + 1), new FSlateColorBrush(FLinearColor::Blue));
+			}
+			FSlateStyleRegistry::RegisterSlateStyle(*Style);
+		}
+
+		~FScopedTestStyle()
+		{
+			FSlateStyleRegistry::UnRegisterSlateStyle(*Style);
+		}
+
+		FName GetName() const { return Style->GetStyleSetName(); }
+	};
+
+	/**
+	 * Console variable override for the duration of a test
+	 */
+	struct FScopedConsoleVariable
+	{
+		IConsoleVariable* Variable;
+		FString PreviousValue;
+
+		FScopedConsoleVariable(const TCHAR* InName, const TCHAR* InValue)
+			: Variable(IConsoleManager::Get().FindConsoleVariable(InName))
+		{
+			check(Variable);
+			PreviousValue = Variable->GetString();
+			Variable->Set(InValue, ECVF_SetByCode);
+		}
+
+		~FScopedConsoleVariable()
+		{
+			Variable->Set(*PreviousValue, ECVF_SetByCode);
+		}
+	};
+
+	inline double SecondsToMicroseconds(double InSeconds) { return InSeconds * 1000000.0; }
+}
+
+#endif
@@ -0,0 +1,636 @@
+﻿// Copyright 2025, Aquanox.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "SlateIconReference.h"
+#include "SlateIconReferenceTestHelpers.h"
+#include "SlateIconReferenceCustomVersion.h"
+#include "SlateIconReferenceLibrary.h"
+#include "SlateIconReferenceModule.h"
+#include "SlateIconSnapshot.h"
+#include "Async/Async.h"
+#include "Framework/Application/SlateApplication.h"
+#include "HAL/PlatformTime.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Styling/SlateStyle.h"
+#include "Styling/SlateStyleRegistry.h"
+#include "Styling/StyleDefaults.h"
+#include "UObject/CoreNet.h"
+#include <atomic>
+
+namespace SlateIconReferenceTests
+{
+	/**
+	 * Serialized bytes along with versions needed to read them back
+	 */
+	struct FSerializedData
+	{
+		TArray<uint8> Bytes;
+		FCustomVersionContainer Versions;
+	};
+
+	static TArray<FSlateIconReference> MakeSerializationCases()
+	{
+		TArray<FSlateIconReference> Cases;
+		Cases.Emplace();
+		Cases.Emplace(TEXT("EditorStyle"), TEXT("Icons.Help"));
+		Cases.Emplace(TEXT("EditorStyle"), TEXT("Icons.Help"), TEXT("Icons.Help.Small"));
+		Cases.Emplace(TEXT("EditorStyle"), TEXT("Icons.Help"), TEXT("Icons.Info"), TEXT("Icons.Warning"));
+		Cases.Emplace(TEXT("EditorStyle"), NAME_None, TEXT(".Small"));
+		Cases.Emplace(NAME_None, TEXT("Icons.Help"), NAME_None, TEXT("Icons.Warning"));
+		Cases.Emplace(TEXT("CoreStyle"), FName(TEXT("Icons.Numbered"), 3), FName(TEXT("Icons.Numbered"), 3));
+		return Cases;
+	}
+
+	// current native format through struct serialization, same path as packages
+	static FSerializedData SaveNative(const FSlateIconReference& InValue)
+	{
+		FSerializedData Data;
+		FMemoryWriter Writer(Data.Bytes);
+		FSlateIconReference Value = InValue;
+		FSlateIconReference::StaticStruct()->SerializeItem(Writer, &Value, nullptr);
+		Data.Versions = Writer.GetCustomVersions();
+		return Data;
+	}
+
+	// tagged property format written before native serialization was added
+	static FSerializedData SaveLegacy(const FSlateIconReference& InValue)
+	{
+		FSerializedData Data;
+		FMemoryWriter Writer(Data.Bytes);
+		FSlateIconReference Value = InValue;
+		FSlateIconReference::StaticStruct()->SerializeTaggedProperties(Writer, reinterpret_cast<uint8*>(&Value), FSlateIconReference::StaticStruct(), nullptr);
+		Data.Versions.SetVersion(FSlateIconReferenceCustomVersion::GUID, FSlateIconReferenceCustomVersion::BeforeCustomVersionWasAdded, TEXT("SlateIconReferenceVer"));
+		return Data;
+	}
+
+	static FSlateIconReference Load(const FSerializedData& InData)
+	{
+		FMemoryReader Reader(InData.Bytes);
+		Reader.SetCustomVersions(InData.Versions);
+		FSlateIconReference Value(TEXT("Garbage"), TEXT("Garbage"), TEXT("Garbage"), TEXT("Garbage"));
+		FSlateIconReference::StaticStruct()->SerializeItem(Reader, &Value, nullptr);
+		return Value;
+	}
+
+	static FString ExportText(const FSlateIconReference& InValue, const FSlateIconReference* InDefaults, int32 PortFlags, bool bAllowNativeOverride = true)
+	{
+		FString Text;
+		FSlateIconReference::StaticStruct()->ExportText(Text, &InValue, InDefaults, nullptr, PortFlags, nullptr, bAllowNativeOverride);
+		return Text;
+	}
+
+	static FSlateIconReference ImportText(const FString& InText, bool& bOutSuccess)
+	{
+		// long form only writes listed members, start from an empty value
+		FSlateIconReference Value;
+		const TCHAR* Result = FSlateIconReference::StaticStruct()->ImportText(*InText, &Value, nullptr, PPF_None, GWarn, FSlateIconReference::StaticStruct()->GetName());
+		bOutSuccess = Result != nullptr;
+		return Value;
+	}
+
+	static FSlateIconReference NetRoundTrip(const FSlateIconReference& InValue, int64& OutNumBits, bool& bOutSuccess)
+	{
+		FSlateIconReference Value = InValue;
+		FNetBitWriter Writer(nullptr, 8192);
+		bool bSaved = false;
+		Value.NetSerialize(Writer, nullptr, bSaved);
+		OutNumBits = Writer.GetNumBits();
+
+		FNetBitReader Reader(nullptr, Writer.GetData(), Writer.GetNumBits());
+		FSlateIconReference Loaded(TEXT("Garbage"), TEXT("Garbage"), TEXT("Garbage"), TEXT("Garbage"));
+		bool bLoaded = false;
+		Loaded.NetSerialize(Reader, nullptr, bLoaded);
+		bOutSuccess = bSaved && bLoaded && !Writer.IsError() && !Reader.IsError() && Reader.AtEnd();
+		return Loaded;
+	}
+
+	/**
+	 * Preload requests shared between test body and latent command
+	 */
+	struct FPreloadTestState
+	{
+		TUniquePtr<FScopedTestStyle> TestStyle;
+		int32 NumReferences = 0;
+		int32 MaxPerFrame = 0;
+		int32 NumFrames = 0;
+		int32 NumCompleted = 0;
+		int32 NumCancelledCompleted = 0;
+	};
+
+	/**
+	 * Waits for time-sliced preload to complete on core ticker
+	 */
+	class FWaitForPreloadCommand : public IAutomationLatentCommand
+	{
+	public:
+		FWaitForPreloadCommand(FAutomationTestBase* InTest, const TSharedRef<FPreloadTestState>& InState)
+			: Test(InTest), State(InState)
+		{
+		}
+
+		virtual bool Update() override
+		{
+			constexpr int32 MaxFrames = 100;
+
+			++State->NumFrames;
+			if (State->NumCompleted == 0 && State->NumFrames < MaxFrames)
+			{
+				return false;
+			}
+
+			Test->TestEqual(TEXT("Time-sliced preload completed once"), State->NumCompleted, 1);
+			Test->TestEqual(TEXT("Cancelled preload never completed"), State->NumCancelledCompleted, 0);
+			if (FSlateApplication::IsInitialized())
+			{ // one tick per slice, the first may run in the same frame as this command
+				const int32 NumSlices = FMath::DivideAndRoundUp(State->NumReferences, State->MaxPerFrame);
+				Test->TestTrue(TEXT("Preload spread over frames"), State->NumFrames >= NumSlices - 1);
+			}
+
+			FSlateIconReference::CancelPendingPreloads();
+			State->TestStyle.Reset();
+			return true;
+		}
+
+	private:
+		FAutomationTestBase* Test;
+		TSharedRef<FPreloadTestState> State;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSlateIconReferenceHashTest, "SlateIconReference.Hash", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSlateIconReferenceHashTest::RunTest(const FString& Parameters)
+{
+	const FSlateIconReference Base(TEXT("Style"), TEXT("Icon"), TEXT("Small"), TEXT("Overlay"));
+
+	const FSlateIconReference Same(TEXT("Style"), TEXT("Icon"), TEXT("Small"), TEXT("Overlay"));
+	TestTrue(TEXT("Equal references compare equal"), Base == Same);
+	TestFalse(TEXT("Equal references are not unequal"), Base != Same);
+	TestEqual(TEXT("Equal references hash equal"), GetTypeHash(Base), GetTypeHash(Same));
+
+	// each of the four names takes part in both equality and hash
+	TArray<FSlateIconReference> Different;
+	Different.Emplace(TEXT("OtherStyle"), TEXT("Icon"), TEXT("Small"), TEXT("Overlay"));
+	Different.Emplace(TEXT("Style"), TEXT("OtherIcon"), TEXT("Small"), TEXT("Overlay"));
+	Different.Emplace(TEXT("Style"), TEXT("Icon"), TEXT("OtherSmall"), TEXT("Overlay"));
+	Different.Emplace(TEXT("Style"), TEXT("Icon"), TEXT("Small"), TEXT("OtherOverlay"));
+	Different.Emplace(TEXT("Style"), TEXT("Icon"), NAME_None, TEXT("Overlay"));
+	Different.Emplace(TEXT("Style"), TEXT("Icon"), TEXT("Small"), NAME_None);
+	// same names in swapped positions
+	Different.Emplace(TEXT("Style"), TEXT("Icon"), TEXT("Overlay"), TEXT("Small"));
+
+	for (int32 Index = 0; Index < Different.Num(); ++Index)
+	{
+		const FString Context = FString::Printf(TEXT("[%d]"), Index);
+		TestFalse(*(Context + TEXT(" unequal references compare unequal")), Base == Different[Index]);
+		TestTrue(*(Context + TEXT(" unequal references are unequal")), Base != Different[Index]);
+		TestNotEqual(*(Context + TEXT(" unequal references hash differently")), GetTypeHash(Base), GetTypeHash(Different[Index]));
+	}
+
+	// cached resolution mode is not part of identity
+	FSlateIconReference Cached = Base;
+	Cached.SetCachedResolution(true);
+	TestTrue(TEXT("Cached mode ignored by equality"), Base == Cached);
+	TestEqual(TEXT("Cached mode ignored by hash"), GetTypeHash(Base), GetTypeHash(Cached));
+
+	TSet<FSlateIconReference> Set;
+	Set.Add(Base);
+	Set.Add(Same);
+	Set.Append(Different);
+	TestEqual(TEXT("Set deduplicates equal references"), Set.Num(), Different.Num() + 1);
+	TestTrue(TEXT("Set finds equal reference"), Set.Contains(Cached));
+	TestFalse(TEXT("Set does not find missing reference"), Set.Contains(FSlateIconReference(TEXT("Style"), TEXT("Missing"))));
+
+	TMap<FSlateIconReference, int32> Map;
+	for (int32 Index = 0; Index < Different.Num(); ++Index)
+	{
+		Map.Add(Different[Index], Index);
+	}
+	Map.Add(Base, -1);
+	Map.Add(Same, -2);
+	TestEqual(TEXT("Map deduplicates equal keys"), Map.Num(), Different.Num() + 1);
+	TestEqual(TEXT("Map overwrites value of equal key"), Map.FindRef(Base), -2);
+	for (int32 Index = 0; Index < Different.Num(); ++Index)
+	{
+		const int32* Found = Map.Find(Different[Index]);
+		TestTrue(*FString::Printf(TEXT("[%d] map finds key"), Index), Found && *Found == Index);
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSlateIconReferenceResolveManyTest, "SlateIconReference.ResolveMany", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSlateIconReferenceResolveManyTest::RunTest(const FString& Parameters)
+{
+	using namespace SlateIconReferenceTests;
+
+	FScopedTestStyle TestStyle;
+
+	TArray<FSlateIconReference> References;
+	References.Emplace(TestStyle.GetName(), TEXT("Test.Icon"));
+	References.Emplace(TestStyle.GetName(), TEXT("Test.Icon"), TEXT("Test.Other"), TEXT("Test.Overlay"));
+	References.Emplace(TestStyle.GetName(), TEXT("Test.Missing"), TEXT("Test.Missing"), TEXT("Test.Missing"));
+	References.Emplace(TEXT("SlateIconReferenceTests.MissingStyle"), TEXT("Test.Icon"));
+	References.Emplace();
+
+	for (const bool bOptional : { false, true })
+	{
+		TArray<const FSlateBrush*> Icons, SmallIcons, OverlayIcons;
+		Icons.SetNumZeroed(References.Num());
+		SmallIcons.SetNumZeroed(References.Num());
+		OverlayIcons.SetNumZeroed(References.Num());
+		FSlateIconReference::ResolveMany(References, Icons, SmallIcons, OverlayIcons, bOptional);
+
+		for (int32 Index = 0; Index < References.Num(); ++Index)
+		{
+			const FSlateIconReference& Reference = References[Index];
+			const FString Context = FString::Printf(TEXT("[%d] optional=%d"), Index, bOptional);
+			TestTrue(*(Context + TEXT(" icon")), Icons[Index] == (bOptional ? Reference.GetOptionalIcon() : Reference.GetIcon()));
+			TestTrue(*(Context + TEXT(" small")), SmallIcons[Index] == (bOptional ? Reference.GetOptionalSmallIcon() : Reference.GetSmallIcon()));
+			TestTrue(*(Context + TEXT(" overlay")), OverlayIcons[Index] == (bOptional ? Reference.GetOptionalOverlayIcon() : Reference.GetOverlayIcon()));
+		}
+
+		// icon-only overload resolves the same icon brushes
+		TArray<const FSlateBrush*> IconsOnly;
+		IconsOnly.SetNumZeroed(References.Num());
+		FSlateIconReference::ResolveMany(References, IconsOnly, bOptional);
+		TestTrue(TEXT("Icon-only overload matches"), IconsOnly == Icons);
+	}
+
+	TestNotNull(TEXT("Derived small icon resolved"), References[0].GetOptionalSmallIcon());
+	TestNull(TEXT("Missing overlay is null"), References[2].GetOptionalOverlayIcon());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSlateIconReferenceCachedResolutionTest, "SlateIconReference.CachedResolution", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSlateIconReferenceCachedResolutionTest::RunTest(const FString& Parameters)
+{
+	using namespace SlateIconReferenceTests;
+
+	TUniquePtr<FScopedTestStyle> TestStyle = MakeUnique<FScopedTestStyle>();
+	const FSlateBrush* IconBrush = TestStyle->Style->GetBrush(TEXT("Test.Icon"));
+	const FSlateBrush* OtherBrush = TestStyle->Style->GetBrush(TEXT("Test.Other"));
+
+	FSlateIconReference Reference(TestStyle->GetName(), TEXT("Test.Icon"));
+	Reference.SetCachedResolution(true);
+	TestTrue(TEXT("Cached mode enabled"), Reference.IsCachedResolution());
+	TestTrue(TEXT("Cold resolve"), Reference.GetIcon() == IconBrush);
+	TestTrue(TEXT("Style set resolved"), Reference.GetStyleSet() == &TestStyle->Style.Get());
+
+	// names written directly are not noticed until generation changes, which shows values come from the cache
+	Reference.IconName = TEXT("Test.Other");
+	TestTrue(TEXT("Warm hit"), Reference.GetIcon() == IconBrush);
+
+	// copies keep the mode but resolve on their own
+	const FSlateIconReference Copy = Reference;
+	TestTrue(TEXT("Copy keeps cached mode"), Copy.IsCachedResolution());
+	TestTrue(TEXT("Copy does not share resolved values"), Copy.GetIcon() == OtherBrush);
+
+	FSlateIconReference Assigned(TestStyle->GetName(), TEXT("Test.Icon"));
+	Assigned = Reference;
+	TestTrue(TEXT("Assigned does not share resolved values"), Assigned.GetIcon() == OtherBrush);
+
+	FSlateIconReference::NotifyStyleRegistryChanged();
+	TestTrue(TEXT("Generation bump invalidates"), Reference.GetIcon() == OtherBrush);
+
+	// unregistration outside of module unload is picked up by module tick
+	const uint32 Generation = FSlateIconReference::GetStyleRegistryGeneration();
+	TestStyle.Reset();
+	FModuleManager::GetModuleChecked<FSlateIconReferenceModule>(TEXT("SlateIconReference")).HandleTick(0.f);
+	TestNotEqual(TEXT("Unregistration bumps generation"), FSlateIconReference::GetStyleRegistryGeneration(), Generation);
+	TestNull(TEXT("Unregistered style set dropped"), Reference.GetStyleSet());
+	TestNull(TEXT("Unregistered icon dropped"), Reference.GetOptionalIcon());
+	TestTrue(TEXT("Fallback for unregistered style set"), Reference.GetIcon() == FStyleDefaults::GetNoBrush());
+
+	Reference.SetCachedResolution(false);
+	TestFalse(TEXT("Cached mode disabled"), Reference.IsCachedResolution());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSlateIconReferenceLibraryTest, "SlateIconReference.Library", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSlateIconReferenceLibraryTest::RunTest(const FString& Parameters)
+{
+	using namespace SlateIconReferenceTests;
+
+	FScopedTestStyle TestStyle;
+	const FSlateBrush& IconBrush = *TestStyle.Style->GetBrush(TEXT("Test.Icon"));
+	const FSlateBrush& OtherBrush = *TestStyle.Style->GetBrush(TEXT("Test.Other"));
+	const FSlateBrush& NoBrush = *FStyleDefaults::GetNoBrush();
+
+	const FSlateIconReference Made = USlateIconReferenceLibrary::MakeSlateIconReference(TestStyle.GetName(), TEXT("Test.Icon"), TEXT("Test.Other"), TEXT("Test.Overlay"));
+	TestTrue(TEXT("Make fills all names"), Made == FSlateIconReference(TestStyle.GetName(), TEXT("Test.Icon"), TEXT("Test.Other"), TEXT("Test.Overlay")));
+
+	TArray<FSlateIconReference> References;
+	References.Emplace(TestStyle.GetName(), TEXT("Test.Icon"));
+	References.Emplace(TestStyle.GetName(), TEXT("Test.Missing"));
+	References.Emplace(TestStyle.GetName(), TEXT("Test.Other"));
+	References.Emplace(TEXT("SlateIconReferenceTests.MissingStyle"), TEXT("Test.Icon"));
+	References.Emplace();
+	References.Emplace(TestStyle.GetName(), NAME_None);
+
+	TestTrue(TEXT("Existing icon is valid"), USlateIconReferenceLibrary::IsValidIconReference(References[0]));
+	TestFalse(TEXT("Missing icon is invalid"), USlateIconReferenceLibrary::IsValidIconReference(References[1]));
+	TestFalse(TEXT("Missing style set is invalid"), USlateIconReferenceLibrary::IsValidIconReference(References[3]));
+	TestFalse(TEXT("Empty reference is invalid"), USlateIconReferenceLibrary::IsValidIconReference(References[4]));
+	TestFalse(TEXT("Reference without icon is invalid"), USlateIconReferenceLibrary::IsValidIconReference(References[5]));
+
+	TestTrue(TEXT("Brush of existing icon"), USlateIconReferenceLibrary::GetIconBrush(References[0]) == IconBrush);
+	TestTrue(TEXT("Empty brush of missing icon"), USlateIconReferenceLibrary::GetIconBrush(References[1]) == NoBrush);
+
+	TArray<FSlateBrush> Brushes;
+	Brushes.SetNum(2);
+	USlateIconReferenceLibrary::ResolveIconBrushes(References, Brushes);
+	TestEqual(TEXT("One brush per reference"), Brushes.Num(), References.Num());
+	if (Brushes.Num() == References.Num())
+	{
+		TestTrue(TEXT("Resolved existing icon"), Brushes[0] == IconBrush);
+		TestTrue(TEXT("Resolved missing icon"), Brushes[1] == NoBrush);
+		TestTrue(TEXT("Resolved other icon"), Brushes[2] == OtherBrush);
+		TestTrue(TEXT("Resolved missing style set"), Brushes[3] == NoBrush);
+		TestTrue(TEXT("Resolved empty reference"), Brushes[4] == NoBrush);
+		for (int32 Index = 0; Index < References.Num(); ++Index)
+		{
+			TestTrue(*FString::Printf(TEXT("[%d] batch matches single"), Index), Brushes[Index] == USlateIconReferenceLibrary::GetIconBrush(References[Index]));
+		}
+	}
+
+	TArray<int32> InvalidIndices = { 42 };
+	TestFalse(TEXT("Validation fails with invalid references"), USlateIconReferenceLibrary::ValidateIconReferences(References, InvalidIndices));
+	TestTrue(TEXT("Invalid indices reported"), InvalidIndices == TArray<int32>({ 1, 3, 4, 5 }));
+
+	const TArray<FSlateIconReference> ValidReferences = { References[0], References[2] };
+	TestTrue(TEXT("Validation passes with valid references"), USlateIconReferenceLibrary::ValidateIconReferences(ValidReferences, InvalidIndices));
+	TestEqual(TEXT("No invalid indices"), InvalidIndices.Num(), 0);
+
+	TestTrue(TEXT("Empty input is valid"), USlateIconReferenceLibrary::ValidateIconReferences(TArray<FSlateIconReference>(), InvalidIndices));
+	USlateIconReferenceLibrary::ResolveIconBrushes(TArray<FSlateIconReference>(), Brushes);
+	TestEqual(TEXT("Empty input resolves nothing"), Brushes.Num(), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSlateIconReferenceResolveManyBenchmark, "SlateIconReference.Benchmark.ResolveMany", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FSlateIconReferenceResolveManyBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace SlateIconReferenceTests;
+
+	constexpr int32 NumIcons = 4096;
+	constexpr int32 NumPasses = 16;
+
+	FScopedTestStyle TestStyleA(TEXT("SlateIconReferenceTests.A"), NumIcons);
+	FScopedTestStyle TestStyleB(TEXT("SlateIconReferenceTests.B"), NumIcons);
+
+	TArray<FSlateIconReference> References;
+	for (int32 Index = 0; Index < NumIcons; ++Index)
+	{
+		References.Emplace((Index & 1) ? TestStyleA.GetName() : TestStyleB.GetName(), FName(TEXT("Test.Extra"), Index + 1), FName(), TEXT("Test.Overlay"));
+	}
+
+	TArray<const FSlateBrush*> Icons, SmallIcons, OverlayIcons;
+	Icons.SetNumZeroed(NumIcons);
+	SmallIcons.SetNumZeroed(NumIcons);
+	OverlayIcons.SetNumZeroed(NumIcons);
+
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+	{
+		for (int32 Index = 0; Index < NumIcons; ++Index)
+		{
+			Icons[Index] = References[Index].GetOptionalIcon();
+			SmallIcons[Index] = References[Index].GetOptionalSmallIcon();
+			OverlayIcons[Index] = References[Index].GetOptionalOverlayIcon();
+		}
+	}
+	const double GetterTime = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+	{
+		FSlateIconReference::ResolveMany(References, Icons, SmallIcons, OverlayIcons, true);
+	}
+	const double BatchTime = FPlatformTime::Seconds() - StartTime;
+
+	const int32 NumResolves = NumIcons * NumPasses;
+	AddInfo(FString::Printf(TEXT("Getters: %.3f us per reference"), SecondsToMicroseconds(GetterTime) / NumResolves));
+	AddInfo(FString::Printf(TEXT("ResolveMany: %.3f us per reference"), SecondsToMicroseconds(BatchTime) / NumResolves));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSlateIconReferencePreloadTest, "SlateIconReference.Preload", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSlateIconReferencePreloadTest::RunTest(const FString& Parameters)
+{
+	using namespace SlateIconReferenceTests;
+
+	constexpr int32 NumExtraIcons = 10;
+
+	TSharedRef<FPreloadTestState> State = MakeShared<FPreloadTestState>();
+	State->TestStyle = MakeUnique<FScopedTestStyle>(TEXT("SlateIconReferenceTests"), NumExtraIcons);
+	State->MaxPerFrame = 3;
+
+	TArray<FSlateIconReference> References;
+	for (int32 Index = 0; Index < NumExtraIcons; ++Index)
+	{
+		References.Emplace(State->TestStyle->GetName(), FName(TEXT("Test.Extra"), Index + 1), NAME_None, TEXT("Test.Overlay"));
+	}
+	References.Emplace();
+	State->NumReferences = References.Num();
+
+	// requests that fit into a single frame complete right away
+	int32 NumImmediate = 0;
+	FSlateIconReference::PreloadIcons(References, 0, FSimpleDelegate::CreateLambda([&NumImmediate]() { ++NumImmediate; }));
+	FSlateIconReference::PreloadIcons(References, References.Num(), FSimpleDelegate::CreateLambda([&NumImmediate]() { ++NumImmediate; }));
+	TestEqual(TEXT("Untimed preloads completed immediately"), NumImmediate, 2);
+
+	// cancelled request is dropped along with its callback
+	FSlateIconReference::PreloadIcons(References, 1, FSimpleDelegate::CreateLambda([State]() { ++State->NumCancelledCompleted; }));
+	FSlateIconReference::CancelPendingPreloads();
+
+	// request made after cancellation is processed by the ticker again
+	FSlateIconReference::PreloadIcons(References, State->MaxPerFrame, FSimpleDelegate::CreateLambda([State]() { ++State->NumCompleted; }));
+	TestEqual(TEXT("Time-sliced preload is pending"), State->NumCompleted, 0);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForPreloadCommand(this, State));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSlateIconSnapshotConcurrencyTest, "SlateIconReference.Snapshot.Concurrency", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSlateIconSnapshotConcurrencyTest::RunTest(const FString& Parameters)
+{
+	using namespace SlateIconReferenceTests;
+
+	FScopedTestStyle TestStyle;
+	const FName StyleSetName = TestStyle.GetName();
+	const FSlateIconReference Reference(StyleSetName, TEXT("Test.Icon"), TEXT("Test.Icon.Small"), TEXT("Test.Overlay"));
+
+	constexpr int32 NumWorkers = 4;
+	constexpr int32 NumPublishes = 50;
+
+	std::atomic<bool> bStop { false };
+	std::atomic<int32> NumReads { 0 };
+	std::atomic<int32> NumInconsistent { 0 };
+
+	// readers release their references at arbitrary points relative to publish and reset on game thread
+	TArray<TFuture<void>> Workers;
+	for (int32 Worker = 0; Worker < NumWorkers; ++Worker)
+	{
+		Workers.Add(Async(EAsyncExecution::ThreadPool, [&bStop, &NumReads, &NumInconsistent, &Reference, StyleSetName]()
+		{
+			while (!bStop.load(std::memory_order_relaxed))
+			{
+				const FSlateIconSnapshot::FSnapshotRef Snapshot = FSlateIconSnapshot::Get();
+				// empty snapshot is handed out until first publish after reset, any other one must be complete
+				if (Snapshot->NumIcons() > 0 && (!Snapshot->ContainsStyleSet(StyleSetName) || !Snapshot->IsValidReference(Reference)))
+				{
+					++NumInconsistent;
+				}
+				++NumReads;
+			}
+		}));
+	}
+
+	for (int32 Iteration = 0; Iteration < NumPublishes; ++Iteration)
+	{
+		FSlateIconReference::NotifyStyleRegistryChanged();
+		FSlateIconSnapshot::Update();
+		if (Iteration % 5 == 4)
+		{
+			FSlateIconSnapshot::Reset();
+		}
+		FSlateIconSnapshot::Get();
+	}
+
+	bStop.store(true, std::memory_order_relaxed);
+	for (TFuture<void>& Worker : Workers)
+	{
+		Worker.Wait();
+	}
+
+	TestTrue(TEXT("Workers acquired snapshots"), NumReads.load() > 0);
+	TestEqual(TEXT("Workers saw only complete snapshots"), NumInconsistent.load(), 0);
+
+	const FSlateIconSnapshot::FSnapshotRef Snapshot = FSlateIconSnapshot::Get();
+	TestEqual(TEXT("Latest snapshot is current"), Snapshot->GetGeneration(), FSlateIconReference::GetStyleRegistryGeneration());
+	TestTrue(TEXT("Latest snapshot contains test style set"), Snapshot->ContainsStyleSet(StyleSetName));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSlateIconReferenceSerializeTest, "SlateIconReference.Serialize", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSlateIconReferenceSerializeTest::RunTest(const FString& Parameters)
+{
+	using namespace SlateIconReferenceTests;
+
+	for (const TCHAR* ElideValue : { TEXT("0"), TEXT("1") })
+	{
+		FScopedConsoleVariable ElideSmallIcon(TEXT("SlateIconReference.ElideDerivedSmallIcon"), ElideValue);
+
+		for (const FSlateIconReference& Case : MakeSerializationCases())
+		{
+			const FString Context = FString::Printf(TEXT("%s:%s|%s|%s elide=%s"),
+				*Case.StyleSetName.ToString(), *Case.IconName.ToString(), *Case.SmallIconName.ToString(), *Case.OverlayIconName.ToString(), ElideValue);
+
+			const FSerializedData Legacy = SaveLegacy(Case);
+			TestTrue(*(Context + TEXT(" legacy")), Load(Legacy) == Case);
+
+			const FSerializedData Native = SaveNative(Case);
+			TestTrue(*(Context + TEXT(" native")), Load(Native) == Case);
+
+			int64 NetBits = 0;
+			bool bNetSuccess = false;
+			TestTrue(*(Context + TEXT(" net")), NetRoundTrip(Case, NetBits, bNetSuccess) == Case);
+			TestTrue(*(Context + TEXT(" net success")), bNetSuccess);
+
+			AddInfo(FString::Printf(TEXT("%s: tagged %d bytes, native %d bytes, net %lld bits"), *Context, Legacy.Bytes.Num(), Native.Bytes.Num(), NetBits));
+		}
+	}
+
+	// data saved with elision must load with elision disabled and vice versa
+	FSerializedData Elided;
+	const FSlateIconReference Derived(TEXT("EditorStyle"), TEXT("Icons.Help"), TEXT("Icons.Help.Small"));
+	{
+		FScopedConsoleVariable ElideSmallIcon(TEXT("SlateIconReference.ElideDerivedSmallIcon"), TEXT("1"));
+		Elided = SaveNative(Derived);
+	}
+	{
+		FScopedConsoleVariable ElideSmallIcon(TEXT("SlateIconReference.ElideDerivedSmallIcon"), TEXT("0"));
+		TestTrue(TEXT("Elided data loads with elision disabled"), Load(Elided) == Derived);
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSlateIconReferenceTextTest, "SlateIconReference.Text", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSlateIconReferenceTextTest::RunTest(const FString& Parameters)
+{
+	using namespace SlateIconReferenceTests;
+
+	for (const FSlateIconReference& Case : MakeSerializationCases())
+	{
+		const FString ShortText = ExportText(Case, nullptr, PPF_None);
+		const FString CopyText = ExportText(Case, nullptr, PPF_Copy);
+		const FString Context = ShortText;
+
+		bool bSuccess = false;
+		TestTrue(*(Context + TEXT(" short")), ImportText(ShortText, bSuccess) == Case && bSuccess);
+		TestTrue(*(Context + TEXT(" copy")), ImportText(CopyText, bSuccess) == Case && bSuccess);
+		TestTrue(*(Context + TEXT(" copy uses long form")), CopyText.StartsWith(TEXT("(")));
+
+		if (!Case.StyleSetName.IsNone())
+		{
+			TestFalse(*(Context + TEXT(" config uses short form")), ShortText.StartsWith(TEXT("(")));
+			TestEqual(*(Context + TEXT(" default left to reflection")), ExportText(Case, &Case, PPF_None), ExportText(Case, &Case, PPF_None, false));
+		}
+	}
+
+	bool bSuccess = false;
+	const FSlateIconReference Expected(TEXT("EditorStyle"), TEXT("Icons.Help"), NAME_None, TEXT("Icons.Warning"));
+	TestTrue(TEXT("Short form with empty small icon"), ImportText(TEXT("EditorStyle:Icons.Help||Icons.Warning"), bSuccess) == Expected && bSuccess);
+	TestTrue(TEXT("Long form"), ImportText(TEXT("(StyleSetName=\"EditorStyle\",IconName=\"Icons.Help\",OverlayIconName=\"Icons.Warning\")"), bSuccess) == Expected && bSuccess);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSlateIconReferenceTextBenchmark, "SlateIconReference.Benchmark.ImportText", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FSlateIconReferenceTextBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace SlateIconReferenceTests;
+
+	constexpr int32 NumValues = 1024;
+	constexpr int32 NumPasses = 16;
+
+	TArray<FString> ShortTexts, LongTexts;
+	for (int32 Index = 0; Index < NumValues; ++Index)
+	{
+		const FSlateIconReference Value(TEXT("EditorStyle"), FName(TEXT("Icons.Numbered"), Index + 1), NAME_None, TEXT("Icons.Warning"));
+		ShortTexts.Add(ExportText(Value, nullptr, PPF_None));
+		LongTexts.Add(ExportText(Value, nullptr, PPF_None, false));
+	}
+
+	auto MeasureImport = [](const TArray<FString>& InTexts, int32 InNumPasses)
+	{
+		bool bSuccess = false;
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Pass = 0; Pass < InNumPasses; ++Pass)
+		{
+			for (const FString& Text : InTexts)
+			{
+				ImportText(Text, bSuccess);
+			}
+		}
+		return SecondsToMicroseconds(FPlatformTime::Seconds() - StartTime) / (InTexts.Num() * InNumPasses);
+	};
+
+	AddInfo(FString::Printf(TEXT("Long form: %.3f us per value, e.g. %s"), MeasureImport(LongTexts, NumPasses), *LongTexts[0]));
+	AddInfo(FString::Printf(TEXT("Short form: %.3f us per value, e.g. %s"), MeasureImport(ShortTexts, NumPasses), *ShortTexts[0]));
+	return true;
+}
+
+#endif
@@ -87,6 +87,9 @@ void SPropertyEditorSlateIconRef::Construct(const FArguments& InArgs, IPropertyT
 		PropertyAccess.GetHandle()->SetOnChildPropertyValueChanged(Handler);
 	}
 
+	// catalog changes are always event driven, tick only watches the value
+	FSlateIconRefDataHelper::GetDataSource().OnCatalogChanged().AddSP(this, &SPropertyEditorSlateIconRef::OnCatalogChanged);
+
 	// Build preview image ==================================
 
 	if (EnumHasAnyFlags(InArgs._DisplayMode, ESlateIconDisplayMode::Compact))
@@ -296,8 +299,48 @@ void SPropertyEditorSlateIconRef::Construct(const FArguments& InArgs, IPropertyT
 void SPropertyEditorSlateIconRef::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
 {
 	if (Switches::bRealtimeUpdates)
+	{
+		// value may change without notification, compare it instead of resolving every frame
+		FSlateIconReference Value;
+		const bool bHasValue = PropertyAccess.ReadPropertyValue(Value);
+
+		if (bHasValue != bSeenHasValue || Value != SeenValue)
+		{
+			bSeenHasValue = bHasValue;
+			SeenValue = Value;
+			OnUpdatePicker();
+		}
+	}
+}
+
+void SPropertyEditorSlateIconRef::OnCatalogChanged(const TArray<FName>& ChangedStyleSets)
+{
+	FSlateIconReference Value;
+	if (!PropertyAccess.ReadPropertyValue(Value))
 	{
 		OnUpdatePicker();
+		return;
+	}
+
+	// icons may come from any style set up the chain, a removed parent is still named by its child
+	FSlateIconRefDataHelper& DataSource = FSlateIconRefDataHelper::GetDataSource();
+	FName StyleSetName = Value.StyleSetName;
+	for (int32 Depth = 0; !StyleSetName.IsNone() && Depth <= DataSource.GetStyleSets().Num(); ++Depth)
+	{
+		if (ChangedStyleSets.Contains(StyleSetName))
+		{
+			OnUpdatePicker();
+			return;
+		}
+
+		TSharedPtr<FSlateStyleSetDescriptor> StyleSet = DataSource.FindStyleSet(StyleSetName, false);
+		if (StyleSet->IsNone())
+		{
+			// not in catalog, descriptors handed out before it was published are stale
+			OnUpdatePicker();
+			return;
+		}
+		StyleSetName = StyleSet->ParentStyleName;
 	}
 }
 
@@ -8,6 +8,7 @@
 #include "Components/SlateWrapperTypes.h"
 #include "Misc/TextFilterExpressionEvaluator.h"
 #include "Internal/SlateIconRefAccessor.h"
+#include "SlateIconReference.h"
 
 class IPropertyTypeCustomizationUtils;
 class IPropertyHandle;
@@ -36,6 +37,7 @@ public:
 private:
 	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
 	void OnUpdatePicker();
+	void OnCatalogChanged(const TArray<FName>& ChangedStyleSets);
 	void OnClear(FName InTarget);
 	bool CanEdit() const;
 
@@ -81,6 +83,10 @@ private:
 	bool bNoClear = false;
 
 	TMap<FName, TSharedRef<FIconSelector>> IconSelectors;
+
+	// value selectors were last resolved for
+	FSlateIconReference SeenValue;
+	bool bSeenHasValue = false;
 	// }
 
 	// { preview image
@@ -37,6 +37,8 @@ void SSlateIconStaticPreview::Construct(const FArguments& InArgs)
 	AutoRefresh = InArgs._AutoRefresh;
 
 	bool bLayered = false;
+	SourceProperty = InArgs._SourceProperty;
+
 	if (InArgs._SourceDescriptor)
 	{
 		UpdateVisualsFunc.BindRaw(this, &SSlateIconStaticPreview::UpdateVisuals, InArgs._SourceDescriptor);
@@ -102,12 +104,36 @@ void SSlateIconStaticPreview::Construct(const FArguments& InArgs)
 
 void SSlateIconStaticPreview::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
 {
-	if (AutoRefresh)
+	if (AutoRefresh && NeedsVisualsUpdate())
 	{
 		UpdateVisualsFunc.ExecuteIfBound();
 	}
 }
 
+bool SSlateIconStaticPreview::NeedsVisualsUpdate()
+{
+	// brushes are copied only when the catalog, the registry or the referenced names change
+	const uint32 CatalogGeneration = FSlateIconRefDataHelper::GetDataSource().GetGeneration();
+	const uint32 RegistryGeneration = FSlateIconReference::GetStyleRegistryGeneration();
+
+	bool bChanged = CatalogGeneration != SeenCatalogGeneration || RegistryGeneration != SeenRegistryGeneration;
+	SeenCatalogGeneration = CatalogGeneration;
+	SeenRegistryGeneration = RegistryGeneration;
+
+	if (SourceProperty.IsValid())
+	{
+		void* RawData = nullptr;
+		const bool bHasValue = SourceProperty->GetValueData(RawData) == FPropertyAccess::Success && RawData;
+		const FSlateIconReference Value = bHasValue ? *static_cast<const FSlateIconReference*>(RawData) : FSlateIconReference();
+
+		bChanged |= bHasValue != bSeenHasValue || Value != SeenValue;
+		bSeenHasValue = bHasValue;
+		SeenValue = Value;
+	}
+
+	return bChanged;
+}
+
 const FSlateBrush* SSlateIconStaticPreview::GetPropertyBrush() const
 {
 	return &TemporaryBrush;
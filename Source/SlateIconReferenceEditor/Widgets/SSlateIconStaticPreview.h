@@ -9,6 +9,7 @@
 #include "Widgets/SCompoundWidget.h"
 #include "Widgets/Images/SLayeredImage.h"
 #include "Internal/SlateIconRefAccessor.h"
+#include "SlateIconReference.h"
 
 #define LOCTEXT_NAMESPACE "SlateIconReference"
 
@@ -42,6 +43,8 @@ private:
 	EVisibility GetVisibilityForPreviewImage() const;
 
 	EVisibility GetVisibilityForPreviewIcon() const;
+
+	bool NeedsVisualsUpdate();
 protected:
 	using FUpdateVisualsFunc = TDelegate<void()>;
 	FUpdateVisualsFunc UpdateVisualsFunc;
@@ -60,6 +63,13 @@ private:
 	TAttribute<float> MaxWidth;
 
 	bool AutoRefresh = true;
+
+	// state visuals were last copied for
+	TSharedPtr<IPropertyHandle> SourceProperty;
+	FSlateIconReference SeenValue;
+	uint32 SeenCatalogGeneration = 0;
+	uint32 SeenRegistryGeneration = 0;
+	bool bSeenHasValue = false;
 };
 
 #undef LOCTEXT_NAMESPACE
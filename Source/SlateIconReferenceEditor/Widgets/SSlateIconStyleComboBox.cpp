@@ -28,6 +28,7 @@ void SSlateIconStyleComboBox::Construct(const FArguments& InArgs)
 #endif
 
 	FSlateIconRefDataHelper::GetDataSource().GatherStyleData(PropertyAccess.AllowClearingValue(), OptionsSource);
+	SeenGeneration = FSlateIconRefDataHelper::GetDataSource().GetGeneration();
 
 	const FComboBoxStyle* ComboStyle = &FStyleHelper::GetWidgetStyle<FComboBoxStyle>("ComboBox");
 
@@ -87,6 +88,16 @@ TSharedRef<SWidget> SSlateIconStyleComboBox::GenerateMenuContent(const FArgument
 				.OnTextCommitted(this, &SSlateIconStyleComboBox::OnSearchTextCommitted)
 			]
 
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(4, 2)
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("IndexingStyleSets", "Indexing icons..."))
+				.Font(FStyleHelper::GetFontStyle( "PropertyWindow.NormalFont" ))
+				.Visibility(this, &SSlateIconStyleComboBox::GetIndexingVisibility)
+			]
+
 			+ SVerticalBox::Slot()
 			.MaxHeight(MaxMenuHeight)
 			.AutoHeight()
@@ -298,8 +309,24 @@ void SSlateIconStyleComboBox::RefreshOptions()
 	ComboListView->RequestListRefresh();
 }
 
+EVisibility SSlateIconStyleComboBox::GetIndexingVisibility() const
+{
+	return bWaitingForCatalog ? EVisibility::Visible : EVisibility::Collapsed;
+}
+
 void SSlateIconStyleComboBox::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
 {
+	// options are gathered again only when catalog changes
+	FSlateIconRefDataHelper& DataSource = FSlateIconRefDataHelper::GetDataSource();
+	bWaitingForCatalog = DataSource.IsBuildInProgress();
+	if (DataSource.GetGeneration() != SeenGeneration)
+	{
+		SeenGeneration = DataSource.GetGeneration();
+		OptionsSource.Reset();
+		DataSource.GatherStyleData(PropertyAccess.AllowClearingValue(), OptionsSource);
+		RefreshOptions();
+	}
+
 	SelectedItem = PropertyAccess.GetStyleDescriptor();
 
 	SComboButton::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
@@ -29,6 +29,7 @@ public:
 
 	void ClearSelection();
 	void RefreshOptions();
+	EVisibility GetIndexingVisibility() const;
 	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
 
 	TSharedPtr<FSlateStyleSetDescriptor> GetSelectedItem() const;
@@ -56,6 +57,10 @@ private:
 	TArray< TSharedPtr<FSlateStyleSetDescriptor> > OptionsSource;
 	TArray< TSharedPtr<FSlateStyleSetDescriptor> > FilteredOptionsSource;
 	TSharedPtr<FSlateStyleSetDescriptor> SelectedItem;
+	// catalog build is running, options come from previous catalog
+	bool bWaitingForCatalog = false;
+	// catalog generation options were gathered for
+	uint32 SeenGeneration = 0;
 
 	TSharedPtr< SEditableTextBox > SearchField;
 	FText SearchText;
@@ -59,9 +59,14 @@ void SSlateIconViewer::Construct(const FArguments& InArgs)
 		GroupFilter = MakeShared<FIconViewerFilter>();
 		GroupFilter->PropertyHandle = MainPropertyHandle;
 		GroupFilter->OnSelectionChanged.BindRaw(this, &SSlateIconViewer::Refresh);
-		GroupFilter->OptionsSource.BindLambda([this](TArray<TSharedPtr<FSlateIconDescriptor>>& OutData)
+		GroupFilter->OptionsSource.BindLambda([this](TArray<FName>& OutData)
 		{
-			OutData.Append(IconsDataSource);
+			const FSlateIconRefDataHelper& DataSource = FSlateIconRefDataHelper::GetDataSource();
+			OutData.Reserve(OutData.Num() + IconIdsSource.Num());
+			for (FSlateIconId Id : IconIdsSource)
+			{
+				OutData.Add(DataSource.GetIconName(Id));
+			}
 		});
 
 		// set default value for group filter to match current
@@ -193,38 +198,44 @@ void SSlateIconViewer::Populate()
 	FName StyleSetName;
 	ReadPropertyValue(&StyleSetName);
 
+	FSlateIconRefDataHelper& DataSource = FSlateIconRefDataHelper::GetDataSource();
+
 	if (LastUsedStyleSet != StyleSetName)
 	{
-		IconsDataSource.Empty();
+		IconIdsSource.Empty();
 		LastUsedStyleSet = StyleSetName;
 
-		const bool bAllowNone = Switches::bShouldListContainNone && !bNoClear;
-		FSlateIconRefDataHelper::GetDataSource().GatherIconData(bAllowNone, StyleSetName, /*recursive=*/ true, IconsDataSource);
+		DataSource.GatherIconIds(StyleSetName, /*recursive=*/ true, IconIdsSource);
 	}
 
-	FilteredDataSource.Empty();
-	for (const TSharedPtr<FViewItem>& IconDescriptor : IconsDataSource)
+	// filled aside so views still listed are reused instead of made again
+	TArray<TSharedPtr<FViewItem>> NewFilteredDataSource;
+	if (Switches::bShouldListContainNone && !bNoClear)
+	{ // add None option to list
+		NewFilteredDataSource.Add(DataSource.EmptyImage);
+	}
+
+	for (FSlateIconId Id : IconIdsSource)
 	{
-		bool bInherited = IconDescriptor->StyleSetName != StyleSetName;
+		const FViewItem IconDescriptor = DataSource.MakeIconView(Id);
+
+		bool bInherited = IconDescriptor.StyleSetName != StyleSetName;
 		if (bInherited && !bShowInheritedFilter)
 			continue;
 		if (TextFilter->GetFilterType() != ETextFilterExpressionType::Empty 
-			&& !TextFilter->TestTextFilter(FBasicStringFilterExpressionContext(IconDescriptor->Name.ToString())))
+			&& !TextFilter->TestTextFilter(FBasicStringFilterExpressionContext(IconDescriptor.Name.ToString())))
 			continue;
-		if (GroupFilter.IsValid() && !GroupFilter->TestFilter(*IconDescriptor))
+		if (GroupFilter.IsValid() && !GroupFilter->TestFilter(IconDescriptor))
 			continue;
-		if (DrawTypeFilter.IsValid() && !DrawTypeFilter->TestFilter(*IconDescriptor))
+		if (DrawTypeFilter.IsValid() && !DrawTypeFilter->TestFilter(IconDescriptor))
 			continue;
-		if (ImageTypeFilter.IsValid() && !ImageTypeFilter->TestFilter(*IconDescriptor))
+		if (ImageTypeFilter.IsValid() && !ImageTypeFilter->TestFilter(IconDescriptor))
 			continue;
 
-		FilteredDataSource.Add(IconDescriptor);
+		NewFilteredDataSource.Add(DataSource.GetIconDescriptor(Id));
 	}
 
-	if (Switches::bShouldListContainNone && !bNoClear)
-	{ // add None option to list
-		FilteredDataSource.Insert( FSlateIconRefDataHelper::GetDataSource().EmptyImage, 0);
-	}
+	FilteredDataSource = MoveTemp(NewFilteredDataSource);
 
 	IconViewerList->RequestListRefresh();
 }
@@ -265,6 +276,16 @@ void SSlateIconViewer::Tick(const FGeometry& AllottedGeometry, const double InCu
 		bPendingFocusNextFrame = false;
 	}
 
+	// list shows published catalog while indexing and is gathered again once catalog changes
+	const FSlateIconRefDataHelper& DataSource = FSlateIconRefDataHelper::GetDataSource();
+	bWaitingForCatalog = DataSource.IsBuildInProgress();
+	if (DataSource.GetGeneration() != SeenGeneration)
+	{
+		SeenGeneration = DataSource.GetGeneration();
+		LastUsedStyleSet = NAME_None;
+		bNeedsRefresh = true;
+	}
+
 	if (bNeedsRefresh)
 	{
 		bNeedsRefresh = false;
@@ -365,13 +386,12 @@ void SSlateIconViewer::OptionsCombo_GenerateDrawTypeMenu(FMenuBuilder& MenuBuild
 
 		DrawTypeFilter->DefaultValue = OPTION_ANY;
 		DrawTypeFilter->SelectedValue = OPTION_ANY;
-		DrawTypeFilter->OnTest.BindLambda([=](const FSlateIconDescriptor& InDesc, const FString& Selected)
+		DrawTypeFilter->OnTest.BindLambda([this](const FSlateIconDescriptor& InDesc, const FString& Selected)
 		{
-			const FSlateBrush* SlateBrush = InDesc.GetBrush();
-			if (!Selected.IsEmpty() && Selected != OPTION_ANY && SlateBrush)
+			const FSlateIconBrushInfo* BrushInfo = InDesc.GetBrushInfo();
+			if (DrawTypeFilter->SelectedEnumValue != INDEX_NONE && BrushInfo)
 			{
-				auto Current = StaticEnum<ESlateBrushDrawType::Type>()->GetNameStringByValue(SlateBrush->GetDrawType());
-				return Selected == Current;
+				return BrushInfo->DrawType == DrawTypeFilter->SelectedEnumValue;
 			}
 			return true;
 		});
@@ -382,13 +402,14 @@ void SSlateIconViewer::OptionsCombo_GenerateDrawTypeMenu(FMenuBuilder& MenuBuild
 	{
 		const FString NameValue = Index == Enum->GetMaxEnumValue() ? OPTION_ANY : Enum->GetNameStringByIndex(Index);
 		const FText DisplayText = Index == Enum->GetMaxEnumValue() ? LOCTEXT("FilterAnyLabel", "Any") : Enum->GetDisplayNameTextByIndex(Index);
+		const int64 EnumValue = Index == Enum->GetMaxEnumValue() ? INDEX_NONE : Enum->GetValueByIndex(Index);
 
 		MenuBuilder.AddMenuEntry(
 			DisplayText,
 			FText::GetEmpty(),
 			FSlateIcon(),
 			FUIAction(
-				FExecuteAction::CreateLambda([this, NameValue](){ DrawTypeFilter->SelectedValue = NameValue; Refresh(); }),
+				FExecuteAction::CreateLambda([this, NameValue, EnumValue](){ DrawTypeFilter->SelectedValue = NameValue; DrawTypeFilter->SelectedEnumValue = EnumValue; Refresh(); }),
 				FCanExecuteAction(),
 				FIsActionChecked::CreateLambda([this, NameValue]() { return DrawTypeFilter->SelectedValue == NameValue; })
 			),
@@ -407,13 +428,12 @@ void SSlateIconViewer::OptionsCombo_GenerateImageTypeSubmenu(FMenuBuilder& MenuB
 		ImageTypeFilter = MakeShared<FIconViewerFilter>();
 		ImageTypeFilter->DefaultValue = OPTION_ANY;
 		ImageTypeFilter->SelectedValue = OPTION_ANY;
-		ImageTypeFilter->OnTest.BindLambda([=](const FSlateIconDescriptor& InDesc, const FString& Selected)
+		ImageTypeFilter->OnTest.BindLambda([this](const FSlateIconDescriptor& InDesc, const FString& Selected)
 		{
-			const FSlateBrush* SlateBrush = InDesc.GetBrush();
-			if (!Selected.IsEmpty() && Selected != OPTION_ANY && SlateBrush)
+			const FSlateIconBrushInfo* BrushInfo = InDesc.GetBrushInfo();
+			if (ImageTypeFilter->SelectedEnumValue != INDEX_NONE && BrushInfo)
 			{
-				auto Current = StaticEnum<ESlateBrushImageType::Type>()->GetNameStringByValue(SlateBrush->GetImageType());
-				return Selected == Current;
+				return BrushInfo->ImageType == ImageTypeFilter->SelectedEnumValue;
 			}
 			return true;
 		});
@@ -424,13 +444,14 @@ void SSlateIconViewer::OptionsCombo_GenerateImageTypeSubmenu(FMenuBuilder& MenuB
 	{
 		const FString NameValue = Index == Enum->GetMaxEnumValue() ? OPTION_ANY : Enum->GetNameStringByIndex(Index);
 		const FText DisplayText = Index == Enum->GetMaxEnumValue() ? LOCTEXT("FilterAnyLabel", "Any") : Enum->GetDisplayNameTextByIndex(Index);
+		const int64 EnumValue = Index == Enum->GetMaxEnumValue() ? INDEX_NONE : Enum->GetValueByIndex(Index);
 
 		MenuBuilder.AddMenuEntry(
 			DisplayText,
 			FText::GetEmpty(),
 			FSlateIcon(),
 			FUIAction(
-				FExecuteAction::CreateLambda([this, NameValue](){ ImageTypeFilter->SelectedValue = NameValue; Refresh(); }),
+				FExecuteAction::CreateLambda([this, NameValue, EnumValue](){ ImageTypeFilter->SelectedValue = NameValue; ImageTypeFilter->SelectedEnumValue = EnumValue; Refresh(); }),
 				FCanExecuteAction(),
 				FIsActionChecked::CreateLambda([this, NameValue]() { return ImageTypeFilter->SelectedValue == NameValue; })
 			),
@@ -449,7 +470,12 @@ void SSlateIconViewer::OptionsCombo_ToggleInherited()
 
 FText SSlateIconViewer::GetSelectedStyleSetIconCountText() const
 {
-	const int32 NumAssets = IconsDataSource.Num() + (bNoClear ? 0 : 1);
+	if (bWaitingForCatalog)
+	{
+		return LOCTEXT("IconCountLabelIndexing", "Indexing icons...");
+	}
+
+	const int32 NumAssets = IconIdsSource.Num() + (Switches::bShouldListContainNone && !bNoClear ? 1 : 0);
 	const int32 NumFilteredAssets = FilteredDataSource.Num();
 
 	FText AssetCount = LOCTEXT("IconCountLabelSingular", "1 item");
@@ -550,15 +576,15 @@ TSharedRef<SWidget> SSlateIconViewer::CreateGroupSelector(TSharedRef<FIconViewer
 
 	Args.OnGetStrings.BindLambda([InContext](TArray<TSharedPtr<FString>>& OutStrings, TArray<TSharedPtr<SToolTip>>& OutToolTips, TArray<bool>& OutRestrictedItems)
 	{
-		TArray<TSharedPtr<FSlateIconDescriptor>> SourceData;
+		TArray<FName> SourceData;
 		InContext->OptionsSource.ExecuteIfBound(SourceData);
 
 		TArray<FString> UniqueGroups;
-		for (const TSharedPtr<FSlateIconDescriptor>& Item : SourceData)
+		for (const FName& Item : SourceData)
 		{
-			if (!Item->IsNone())
+			if (!Item.IsNone())
 			{
-				FString IconName = Item->Name.ToString();
+				FString IconName = Item.ToString();
 				FString Group;
 				if (IconName.Split(TEXT("."), &Group, nullptr))
 				{
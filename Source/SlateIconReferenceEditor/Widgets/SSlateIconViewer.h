@@ -12,7 +12,7 @@
 #include "PropertyCustomizationHelpers.h"
 #include "Internal/SlateIconRefAccessor.h"
 
-using FOnGatherData = TDelegate<void(TArray<TSharedPtr<FSlateIconDescriptor>>&)>;
+using FOnGatherData = TDelegate<void(TArray<FName>&)>;
 using FOnFilterChanged = TDelegate<void()>;
 using FOnFilterTest = TDelegate<bool(const FSlateIconDescriptor&, const FString&)>;
 
@@ -23,6 +23,8 @@ struct FIconViewerFilter
 
 	FString DefaultValue;
 	FString SelectedValue;
+	// enum value matching SelectedValue for filters over brush info, none for any
+	int64 SelectedEnumValue = INDEX_NONE;
 
 	FOnGatherData OptionsSource;
 	FOnFilterChanged OnSelectionChanged;
@@ -95,6 +97,10 @@ private:
 	bool bNoClear = false;
 	bool bPendingFocusNextFrame = false;
 	bool bNeedsRefresh = false;
+	// catalog build is running, list shows previous catalog
+	bool bWaitingForCatalog = false;
+	// catalog generation icons were gathered for
+	uint32 SeenGeneration = 0;
 
 	FOnIconSelected OnIconSelected;
 
@@ -118,7 +124,8 @@ private:
 	// { menu - icon listview
 	TSharedPtr<SListView<TSharedPtr<FViewItem>>> IconViewerList;
 	FName LastUsedStyleSet = NAME_None;
-	TArray<TSharedPtr<FViewItem>> IconsDataSource;
+	// every icon of the style set, views are made only for icons passing filters
+	TArray<FSlateIconId> IconIdsSource;
 	TArray<TSharedPtr<FViewItem>> FilteredDataSource;
 	// }
 };